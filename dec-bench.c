@@ -0,0 +1,564 @@
+/* HPACK decoder benchmark for experimentation purposes.
+ *
+ * By default it measures hpack_dec_frame() on header blocks made only of
+ * indexed fields, which is what a decoder mostly sees once the dynamic table
+ * of a connection is warm. A first block inserts <entries> literals into the
+ * dynamic table, then <blocks> blocks of <fields> indexed fields referencing
+ * random static and dynamic entries are decoded <loops> times. With "-f", the
+ * blocks are instead read from a file in mini-dec's input format (eg:
+ * mini-enc's output), and the whole stream is decoded <loops> times, each
+ * time with a fresh context, in fragments of <frag> bytes with "-F". Fields
+ * are only stored into a header list and not printed, and only the time spent
+ * in the decoder is reported. With "-k", the blocks are visited instead and
+ * only the values of the comma-separated <names> are requested, and with "-V"
+ * they are only validated. Before measuring anything, a few blocks which once
+ * failed are decoded in all these modes and checked.
+ *
+ *     ./dec-bench [-l loops] [-n fields] [-s size] [-f blocks.hex [-F frag | -k names | -V]]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hpack.h"
+
+/* static table entries (RFC7541 appendix A) */
+#define SH_SIZE 61
+
+/* dynamic table entries and blocks of the indexed workload */
+#define ENTRIES 40
+#define BLOCKS  256
+
+/* largest block, matching mini-dec's */
+#define MAX_INPUT 4096
+
+struct block {
+	uint8_t *raw;
+	uint32_t len;
+};
+
+static struct block *blocks;
+static int nb_blocks;
+
+/* decoded header list, each field takes at least one byte */
+static struct hpack_hdr list[MAX_INPUT];
+
+/* input line: hex chars + \n + \0 */
+static char in_hex[MAX_INPUT*2+2];
+
+/* header names whose values are requested with "-k", and their total size */
+#define MAX_KEEP 16
+static struct str keep[MAX_KEEP];
+static int nb_keep = -1;
+static uint64_t kept_bytes;
+
+/* set by "-V" to only validate the blocks */
+static int validate;
+
+/* fills keep[] from <list> of comma-separated names */
+static void parse_keep(const char *list)
+{
+	const char *end;
+
+	for (nb_keep = 0; *list && nb_keep < MAX_KEEP; nb_keep++) {
+		end = strchr(list, ',');
+		if (!end)
+			end = list + strlen(list);
+		keep[nb_keep] = mkstr(list, end - list);
+		list = *end ? end + 1 : end;
+	}
+}
+
+/* visitor callbacks requesting the values of the fields named in keep[] */
+static int keep_name(__attribute__((unused)) void *arg,
+                     __attribute__((unused)) uint32_t sidx, struct str name)
+{
+	int i;
+
+	for (i = 0; i < nb_keep; i++)
+		if (keep[i].len == name.len && memcmp(keep[i].ptr, name.ptr, name.len) == 0)
+			return 1;
+	return 0;
+}
+
+static void keep_value(__attribute__((unused)) void *arg,
+                       __attribute__((unused)) struct str name, struct str value)
+{
+	kept_bytes += value.len;
+}
+
+static const struct hpack_dec_visitor keep_visitor = {
+	.name  = keep_name,
+	.value = keep_value,
+};
+
+/* returns the current time in nanoseconds */
+static inline uint64_t now_ns()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* returns 0 to 15 for 0..[fF], or < 0 if not hex */
+static inline int hextoi(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+/* appends a copy of block <raw> of <len> bytes. Returns < 0 on error. */
+static int add_block(const uint8_t *raw, uint32_t len)
+{
+	struct block *new;
+
+	if ((nb_blocks & (nb_blocks - 1)) == 0) {
+		new = realloc(blocks, (nb_blocks ? nb_blocks * 2 : 1) * sizeof(*blocks));
+		if (!new)
+			return -1;
+		blocks = new;
+	}
+
+	blocks[nb_blocks].raw = malloc(len ? len : 1);
+	if (!blocks[nb_blocks].raw)
+		return -1;
+	memcpy(blocks[nb_blocks].raw, raw, len);
+	blocks[nb_blocks].len = len;
+	nb_blocks++;
+	return 0;
+}
+
+/* loads one block per line of hex-encoded file <file>. Returns < 0 on error. */
+static int load_blocks(const char *file)
+{
+	static uint8_t raw[MAX_INPUT];
+	uint32_t len;
+	FILE *f;
+	int v1, v2;
+	char *i;
+
+	f = fopen(file, "r");
+	if (!f)
+		return -1;
+
+	while (fgets(in_hex, sizeof(in_hex), f)) {
+		i = in_hex;
+		len = 0;
+		while (len < sizeof(raw) && (v1 = hextoi(i[0])) >= 0 && (v2 = hextoi(i[1])) >= 0) {
+			raw[len++] = (v1 << 4) + v2;
+			i += 2;
+		}
+		if (len && add_block(raw, len) < 0) {
+			fclose(f);
+			return -1;
+		}
+	}
+	fclose(f);
+	return 0;
+}
+
+/* builds the indexed workload : one block inserting ENTRIES literals with
+ * static names, followed by BLOCKS blocks of <fields> indexed fields, half of
+ * which reference the dynamic table. The generator is seeded so that runs are
+ * comparable. Returns < 0 on error.
+ */
+static int make_blocks(int fields)
+{
+	static uint8_t raw[MAX_INPUT];
+	char value[64];
+	uint32_t len = 0;
+	int b, f, vlen, idx;
+
+	srandom(0);
+	for (f = 0; f < ENTRIES; f++) {
+		vlen = snprintf(value, sizeof(value), "value-%d-%0*d", f, (int)(random() % 24), 0);
+		len += put_var_int(raw + len, 0x40, 1 + random() % SH_SIZE, 6);
+		len += put_var_int(raw + len, 0x00, vlen, 7);
+		memcpy(raw + len, value, vlen);
+		len += vlen;
+	}
+	if (add_block(raw, len) < 0)
+		return -1;
+
+	for (b = 0; b < BLOCKS; b++) {
+		len = 0;
+		for (f = 0; f < fields && len + 5 <= sizeof(raw); f++) {
+			if (random() & 1)
+				idx = 1 + random() % SH_SIZE;
+			else
+				idx = SH_SIZE + 1 + random() % ENTRIES;
+			len += put_var_int(raw + len, 0x80, idx, 7);
+		}
+		if (add_block(raw, len) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+/* decodes block <raw> of <len> bytes with a fresh context of <size> bytes, at
+ * once, in fragments of <frag> bytes unless it is zero, or only validates it if
+ * <frag> is negative. Unless validated, the last field's value must match
+ * <value> if it is set. Returns the number of fields or < 0 on error.
+ */
+static int check_block(const uint8_t *raw, uint32_t len, int size, int frag, const char *value)
+{
+	struct hpack_dec_ctx ctx;
+	uint32_t off = 0, n;
+	int ret, nb = 0;
+
+	if (hpack_dec_init(&ctx, size) < 0)
+		return -1;
+	ctx.quiet = 1;
+
+	if (frag < 0)
+		ret = hpack_dec_validate(&ctx, raw, len);
+	else if (!frag)
+		ret = hpack_dec_frame(&ctx, raw, len, list, MAX_INPUT);
+	else {
+		do {
+			n = len - off < (uint32_t)frag ? len - off : (uint32_t)frag;
+			ret = hpack_dec_feed(&ctx, raw + off, n, off + n == len, list + nb, MAX_INPUT - nb);
+			nb += ret;
+			off += n;
+		} while (ret >= 0 && off < len);
+		if (ret >= 0)
+			ret = nb;
+	}
+
+	if (ret > 0 && frag >= 0 && value &&
+	    (list[ret - 1].v.len != strlen(value) || memcmp(list[ret - 1].v.ptr, value, strlen(value)) != 0))
+		ret = -1;
+
+	hpack_dec_free(&ctx);
+	return ret;
+}
+
+/* decodes with a 128 kB table a block made of a literal with incremental
+ * indexing whose value is <vlen> bytes long, then of an indexed field to the
+ * new entry, whose value must match. Returns the same as check_block().
+ */
+static int check_big_value(int vlen, int frag)
+{
+	uint32_t len = 0;
+	uint8_t *raw;
+	char *value;
+	int ret = -1;
+
+	raw = malloc(vlen + 16);
+	value = malloc(vlen + 1);
+	if (raw && value) {
+		memset(value, 'v', vlen);
+		value[vlen] = 0;
+		len += put_var_int(raw + len, 0x40, 0, 6);
+		len += put_var_int(raw + len, 0x00, 5, 7);
+		memcpy(raw + len, "x-big", 5);
+		len += 5;
+		len += put_var_int(raw + len, 0x00, vlen, 7);
+		memcpy(raw + len, value, vlen);
+		len += vlen;
+		len += put_var_int(raw + len, 0x80, SH_SIZE + 1, 7);
+		ret = check_block(raw, len, 131072, frag, value);
+	}
+	free(raw);
+	free(value);
+	return ret;
+}
+
+/* checks a few blocks which once failed, in all decoding modes. Returns the
+ * number of errors.
+ */
+static int check_blocks()
+{
+	static const int frags[] = { 0, 1, 7, -1 };
+	static const struct {
+		uint8_t b[7];
+		int len;
+		int ret;
+	} ints[] = {
+		{ { 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 }, 7, -1 }, /* 6 continuation bytes */
+		{ { 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f }, 6, -1 },       /* 2^35 + 2^7 - 2 */
+		{ { 0xff, 0x81, 0xff, 0xff, 0xff, 0x0f }, 6, -1 },       /* 2^32 */
+		{ { 0xff, 0x80, 0xff, 0xff, 0xff, 0x0f }, 6, -8 },       /* 2^32 - 1 */
+	};
+	uint8_t raw[1024];
+	char value[200];
+	uint32_t len = 0;
+	int errors = 0;
+	int hlen, i, j, tail;
+
+	/* a literal with incremental indexing whose value is made of 5-bit
+	 * codes and decodes into all of the 8/5 of its Huffman-encoded length
+	 * reserved for it in the dynamic table.
+	 */
+	memset(value, 'e', 102);
+	value[102] = 0;
+	len += put_var_int(raw + len, 0x40, 0, 6);
+	len += put_var_int(raw + len, 0x00, 6, 7);
+	memcpy(raw + len, "x-long", 6);
+	len += 6;
+	hlen = huff_enc(value, (char *)raw + len + 1);
+	len += put_var_int(raw + len, 0x80, hlen, 7);
+	len += hlen;
+
+	for (i = 0; i < (int)(sizeof(frags) / sizeof(frags[0])); i++) {
+		if (check_block(raw, len, 4096, frags[i], value) != 1) {
+			fprintf(stderr, "long value decoding failed (frag=%d)\n", frags[i]);
+			errors++;
+		}
+	}
+
+	/* a literal announcing a Huffman-encoded name of 0x40000080 bytes,
+	 * whose room once wrapped when received in fragments, followed by
+	 * more bytes than this room.
+	 */
+	len = 0;
+	len += put_var_int(raw + len, 0x00, 0, 4);
+	len += put_var_int(raw + len, 0x80, 0x40000080, 7);
+	memset(raw + len, 'a', sizeof(raw) - len);
+	len = sizeof(raw);
+
+	for (i = 0; i < (int)(sizeof(frags) / sizeof(frags[0])); i++) {
+		if (check_block(raw, len, 4096, frags[i], NULL) != -2) {
+			fprintf(stderr, "oversized string not rejected (frag=%d)\n", frags[i]);
+			errors++;
+		}
+	}
+
+	/* with an empty dynamic table, the last static entry is valid, but the
+	 * next index, either indexed or as a literal's name, must be rejected.
+	 */
+	for (i = 0; i < (int)(sizeof(frags) / sizeof(frags[0])); i++) {
+		len = put_var_int(raw, 0x80, SH_SIZE, 7);
+		if (check_block(raw, len, 4096, frags[i], NULL) != 1) {
+			fprintf(stderr, "last static index rejected (frag=%d)\n", frags[i]);
+			errors++;
+		}
+
+		len = put_var_int(raw, 0x80, SH_SIZE + 1, 7);
+		if (check_block(raw, len, 4096, frags[i], NULL) != -8) {
+			fprintf(stderr, "index past the tables not rejected (frag=%d)\n", frags[i]);
+			errors++;
+		}
+
+		len = put_var_int(raw, 0x00, SH_SIZE + 1, 4);
+		len += put_var_int(raw + len, 0x00, 1, 7);
+		raw[len++] = 'a';
+		if (check_block(raw, len, 4096, frags[i], NULL) != -8) {
+			fprintf(stderr, "name index past the tables not rejected (frag=%d)\n", frags[i]);
+			errors++;
+		}
+
+		len = put_var_int(raw, 0x40, SH_SIZE + 1, 6);
+		len += put_var_int(raw + len, 0x00, 1, 7);
+		raw[len++] = 'a';
+		if (check_block(raw, len, 4096, frags[i], NULL) != -8) {
+			fprintf(stderr, "inserted name index past the tables not rejected (frag=%d)\n", frags[i]);
+			errors++;
+		}
+	}
+
+	/* integers with more than 5 continuation bytes or above 32 bits must be
+	 * rejected instead of wrapping, whether at least 8 bytes follow their
+	 * first one or not. Valid ones are indexes past the tables.
+	 */
+	for (i = 0; i < (int)(sizeof(frags) / sizeof(frags[0])); i++) {
+		for (j = 0; j < (int)(sizeof(ints) / sizeof(ints[0])); j++) {
+			for (tail = 0; tail <= 8; tail += 8) {
+				memcpy(raw, ints[j].b, ints[j].len);
+				memset(raw + ints[j].len, 0x82, tail);
+				len = ints[j].len + tail;
+				if (check_block(raw, len, 4096, frags[i], NULL) != ints[j].ret) {
+					fprintf(stderr, "integer %d mishandled (tail=%d frag=%d)\n", j, tail, frags[i]);
+					errors++;
+				}
+			}
+		}
+	}
+
+	/* in a 128 kB table, a literal with incremental indexing whose value
+	 * is as long as an entry may store, then one byte longer, which must be
+	 * rejected instead of being stored with a truncated length.
+	 */
+	for (i = 0; i < (int)(sizeof(frags) / sizeof(frags[0])); i++) {
+		for (hlen = DHT_STR_MAX; hlen <= DHT_STR_MAX + 1; hlen++) {
+			if (check_big_value(hlen, frags[i]) != (hlen > DHT_STR_MAX ? -9 : 2)) {
+				fprintf(stderr, "%d-byte value mishandled (frag=%d)\n", hlen, frags[i]);
+				errors++;
+			}
+		}
+	}
+	return errors;
+}
+
+/* initializes <ctx> for the benchmark. Returns < 0 on error. */
+static int bench_init(struct hpack_dec_ctx *ctx, int size)
+{
+	if (hpack_dec_init(ctx, size) < 0)
+		return -1;
+	ctx->quiet = 1;
+	return 0;
+}
+
+/* decodes the indexed blocks <loops> times after the first one filled the
+ * table, and reports the time per block and per field. Returns < 0 on error.
+ */
+static int bench_indexed(int loops, int size)
+{
+	struct hpack_dec_ctx ctx;
+	uint64_t start, ns;
+	int b, l, ret = 0;
+
+	if (bench_init(&ctx, size) < 0)
+		return -1;
+
+	if (hpack_dec_frame(&ctx, blocks[0].raw, blocks[0].len, list, MAX_INPUT) < 0) {
+		hpack_dec_free(&ctx);
+		return -1;
+	}
+
+	ctx.st.blocks = ctx.st.fields = 0;
+	start = now_ns();
+	for (l = 0; l < loops; l++)
+		for (b = 1; b < nb_blocks; b++)
+			if (hpack_dec_frame(&ctx, blocks[b].raw, blocks[b].len, list, MAX_INPUT) < 0)
+				ret = -1;
+	ns = now_ns() - start;
+
+	if (ret >= 0) {
+		printf("indexed blocks   : %d x %d blocks, %d fields\n", loops, nb_blocks - 1, ctx.st.fields);
+		printf("  per block      : %8.1f ns\n", (double)ns / ctx.st.blocks);
+		printf("  per field      : %8.2f ns (%.1f Mfields/s)\n",
+		       (double)ns / ctx.st.fields, ctx.st.fields * 1000.0 / ns);
+	}
+	hpack_dec_free(&ctx);
+	return ret;
+}
+
+/* decodes block <b> with <ctx> in fragments of <frag> bytes. Returns < 0 on
+ * error.
+ */
+static int feed_block(struct hpack_dec_ctx *ctx, int b, uint32_t frag)
+{
+	uint32_t off = 0, n;
+	int ret;
+
+	do {
+		n = blocks[b].len - off < frag ? blocks[b].len - off : frag;
+		ret = hpack_dec_feed(ctx, blocks[b].raw + off, n, off + n == blocks[b].len, list, MAX_INPUT);
+		off += n;
+	} while (ret >= 0 && off < blocks[b].len);
+	return ret;
+}
+
+/* decodes all blocks <loops> times, each time with a fresh context, in
+ * fragments of <frag> bytes unless it is zero, or validates them if "-V" was
+ * given or visits them if "-k" was given, and reports the time per block and
+ * per field. Returns < 0 on error.
+ */
+static int bench_stream(int loops, int size, int frag)
+{
+	struct hpack_dec_ctx ctx;
+	uint64_t ns = 0, start;
+	int b, l, ret = 0;
+	int nb = 0, fields = 0;
+
+	for (l = 0; l < loops && ret >= 0; l++) {
+		if (bench_init(&ctx, size) < 0)
+			return -1;
+		start = now_ns();
+		for (b = 0; b < nb_blocks && ret >= 0; b++) {
+			if (validate)
+				ret = hpack_dec_validate(&ctx, blocks[b].raw, blocks[b].len);
+			else if (nb_keep >= 0)
+				ret = hpack_dec_visit(&ctx, blocks[b].raw, blocks[b].len, &keep_visitor, NULL);
+			else if (frag > 0)
+				ret = feed_block(&ctx, b, frag);
+			else
+				ret = hpack_dec_frame(&ctx, blocks[b].raw, blocks[b].len, list, MAX_INPUT);
+		}
+		ns += now_ns() - start;
+		nb += ctx.st.blocks;
+		fields += ctx.st.fields;
+		hpack_dec_free(&ctx);
+	}
+
+	if (ret >= 0) {
+		printf("stream           : %d x %d blocks, %d fields\n", loops, nb_blocks, fields);
+		printf("  per block      : %8.1f ns\n", (double)ns / nb);
+		printf("  per field      : %8.2f ns (%.1f Mfields/s)\n",
+		       (double)ns / fields, fields * 1000.0 / ns);
+	}
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	const char *file = NULL;
+	int loops = 1000;
+	int fields = 24;
+	int size = 4096;
+	int frag = 0;
+	int ret;
+
+	while (argc > 1) {
+		if (strcmp(argv[1], "-l") == 0 && argc > 2) {
+			loops = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		else if (strcmp(argv[1], "-n") == 0 && argc > 2) {
+			fields = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		else if (strcmp(argv[1], "-s") == 0 && argc > 2) {
+			size = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		else if (strcmp(argv[1], "-f") == 0 && argc > 2) {
+			file = argv[2];
+			argv++;
+			argc--;
+		}
+		else if (strcmp(argv[1], "-k") == 0 && argc > 2) {
+			parse_keep(argv[2]);
+			argv++;
+			argc--;
+		}
+		else if (strcmp(argv[1], "-V") == 0)
+			validate = 1;
+		else if (strcmp(argv[1], "-F") == 0 && argc > 2) {
+			frag = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		argv++;
+		argc--;
+	}
+
+	if (check_blocks()) {
+		fprintf(stderr, "decoding errors\n");
+		exit(1);
+	}
+
+	if (file ? load_blocks(file) < 0 : make_blocks(fields) < 0) {
+		fprintf(stderr, "failed to load input\n");
+		exit(1);
+	}
+
+	ret = file ? bench_stream(loops, size, frag) : bench_indexed(loops, size);
+	if (ret < 0) {
+		fprintf(stderr, "decoding error (%d)\n", ret);
+		exit(1);
+	}
+	return 0;
+}
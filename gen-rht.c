@@ -7,6 +7,8 @@
  * rht_bit11_4[256]    is indexed on bits 11..4 when 15..8 == 0xff
  * when 11..4 == 0xff, 3..2 provide the following mapping :
  *   00 => 0x0a, 01 => 0x0d, 10 => 0x16, 11 => EOS
+ *
+ * It also generates the perfect hash of the static table's names ("-s").
  */
 
 #include <stdint.h>
@@ -14,6 +16,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* FSM flags, see gen_rht_fsm() */
+#define RHT_FSM_SYM_FLAG    1
+#define RHT_FSM_FAIL_FLAG   2
+#define RHT_FSM_ACCEPT_FLAG 4
+
 /* from RFC7541 Appendix B */
 static const struct huff {
 	uint32_t c; /* code point */
@@ -279,7 +286,8 @@ static const struct huff {
 };
 
 
-int main(int argc, char **argv)
+/* dumps the 5 cascaded single-symbol tables used by huff_dec() */
+static void gen_rht_cascade()
 {
 	uint32_t c, i, j;
 
@@ -365,5 +373,427 @@ int main(int argc, char **argv)
 	}
 	printf("\t/* Note, when l==30, bits 3..2 give 00:0x0a, 01:0x0d, 10:0x16, 11:EOS */\n");
 	printf("};\n\n");
+}
+
+/* looks up the symbol whose code starts at the MSB of <code> and is no longer
+ * than <max> bits. Returns the symbol or -1 if none matches.
+ */
+static int lookup_sym(uint32_t code, int max)
+{
+	uint32_t i;
+
+	for (i = 0; i < sizeof(ht)/sizeof(ht[0]) - 1; i++) {
+		if (ht[i].b > max)
+			continue;
+		if ((code >> (32 - ht[i].b)) == ht[i].c)
+			return i;
+	}
+	return -1;
+}
+
+/* dumps the multi-symbol table used by huff_dec_ms(). It is indexed on the
+ * <bits> upper bits of the stream, and each entry holds up to 2 symbols fully
+ * contained in these bits, with <l1> the length of the first one and <l> the
+ * total length. Entries starting with a code longer than <bits> are left empty
+ * (l1 == 0) and must be decoded using the cascaded tables.
+ */
+static void gen_rht_ms(int bits)
+{
+	uint32_t j, code;
+	int sym[2], len[2];
+	int n;
+
+	printf("/* Multi-symbol reversed huffman table, generated by \"gen-rht -m %d\".\n", bits);
+	printf(" * Do not edit, it is indexed on the %d upper bits of the stream. Entries\n", bits);
+	printf(" * with l1 == 0 start with a code longer than this and must be looked up\n");
+	printf(" * in the cascaded tables.\n");
+	printf(" */\n");
+	printf("#define RHT_MS_BITS %d\n\n", bits);
+	printf("static const struct rht_ms rht_ms[1 << RHT_MS_BITS] = {\n");
+	for (j = 0; j < (1U << bits); j++) {
+		code = j << (32 - bits);
+		for (n = 0; n < 2; n++) {
+			sym[n] = lookup_sym(code, bits - (n ? len[0] : 0));
+			if (sym[n] < 0)
+				break;
+			len[n] = ht[sym[n]].b;
+			code <<= len[n];
+		}
+
+		if (n == 1)
+			printf("\t[0x%03x] = { .c = { 0x%02x, 0x00 }, .l1 = %d, .l = %d },\n",
+			       j, sym[0], len[0], len[0]);
+		else if (n == 2)
+			printf("\t[0x%03x] = { .c = { 0x%02x, 0x%02x }, .l1 = %d, .l = %d },\n",
+			       j, sym[0], sym[1], len[0], len[0] + len[1]);
+	}
+	printf("};\n");
+}
+
+/* dumps the tables used by huff_dec_canon(). HPACK's code is canonical : codes
+ * of the same length are consecutive and sorted by symbol, and the first code
+ * of a length follows the last one of the previous length. It is verified here
+ * and the function fails if it is not the case. The following tables are then
+ * emitted :
+ *   - rht_canon_limit[l] : the first code of length > l, left-aligned on 32
+ *     bits. A code of length l is thus the first l for which the MSB-aligned
+ *     stream is below this limit. It is 0 for l < 5, and the limit of length
+ *     30 excludes EOS.
+ *   - rht_canon_ofs[l] : the position in rht_canon_sym[] of the first code of
+ *     length l.
+ *   - rht_canon_start[n] : the shortest length to try when the stream starts
+ *     with exactly n bits set to one. This avoids walking over the shortest
+ *     lengths for long codes.
+ *   - rht_canon_sym[] : the symbols sorted by code.
+ */
+static int gen_rht_canon()
+{
+	uint32_t limit[31] = { 0 };
+	uint8_t ofs[31] = { 0 };
+	uint8_t sym[256];
+	uint32_t code, wmin;
+	int i, l, n, pos, max_steps;
+
+	/* build the sorted symbols list and check the code is canonical */
+	code = 0;
+	pos = 0;
+	for (l = 1; l <= 30; l++) {
+		ofs[l] = pos;
+		for (i = 0; i < 256; i++) {
+			if (ht[i].b != l)
+				continue;
+			if (ht[i].c != code) {
+				fprintf(stderr, "code for sym 0x%02x is not canonical\n", i);
+				return 1;
+			}
+			sym[pos++] = i;
+			code++;
+		}
+		limit[l] = l < 30 ? code << (32 - l) : code << 2;
+		code <<= 1;
+	}
+
+	printf("/* Canonical huffman decoding tables, generated by \"gen-rht -c\".\n");
+	printf(" * Do not edit, see gen-rht.c for their description.\n");
+	printf(" */\n");
+	printf("#define RHT_CANON_EOS 0x%08x /* codes at or above this are EOS */\n\n", limit[30]);
+
+	printf("static const uint32_t rht_canon_limit[31] = {\n");
+	for (l = 0; l <= 30; l++)
+		printf("\t[%2d] = 0x%08x,\n", l, limit[l]);
+	printf("};\n\n");
+
+	printf("static const uint8_t rht_canon_ofs[31] = {\n");
+	for (l = 5; l <= 30; l++)
+		printf("\t[%2d] = %3d,\n", l, ofs[l]);
+	printf("};\n\n");
+
+	max_steps = 0;
+	printf("static const uint8_t rht_canon_start[32] = {\n");
+	for (n = 0; n < 32; n++) {
+		wmin = n ? ~0U << (32 - n) : 0;
+		if (wmin >= limit[30])
+			break;
+		for (l = 5; l < 30 && limit[l] <= wmin; l++)
+			;
+		/* longest length reachable with exactly n leading ones */
+		for (i = l; i < 30 && limit[i] <= (n < 31 ? wmin | (~0U >> (n + 1)) : wmin); i++)
+			;
+		if (i - l > max_steps)
+			max_steps = i - l;
+		printf("\t[%2d] = %2d,\n", n, l);
+	}
+	printf("};\n");
+	printf("\n/* at most this number of extra lengths to walk after rht_canon_start[] */\n");
+	printf("#define RHT_CANON_MAX_STEPS %d\n\n", max_steps);
+
+	printf("static const uint8_t rht_canon_sym[256] = {\n");
+	for (i = 0; i < 256; i++)
+		printf("%s0x%02x,%s", (i & 7) ? " " : "\t", sym[i], ((i & 7) == 7) ? "\n" : "");
+	printf("};\n");
+	return 0;
+}
+
+/* Huffman tree used to build the FSM. Internal nodes are numbered from 0 (the
+ * root) to 255 and are the FSM states. A child is either an internal node or
+ * a leaf, in which case it holds the symbol + 256.
+ */
+static int tree[256][2];
+static int tree_nodes = 1;
+
+/* inserts all codes into the tree. Returns < 0 on error. */
+static int build_tree()
+{
+	int i, bit, node, *child;
+
+	memset(tree, 0xff, sizeof(tree)); /* -1 : no child yet */
+	for (i = 0; i < 257; i++) {
+		node = 0;
+		for (bit = ht[i].b - 1; bit >= 0; bit--) {
+			child = &tree[node][(ht[i].c >> bit) & 1];
+			if (!bit) {
+				*child = 256 + i;
+				break;
+			}
+			if (*child < 0) {
+				if (tree_nodes >= 256)
+					return -1;
+				*child = tree_nodes++;
+			}
+			node = *child;
+		}
+	}
+	return 0;
+}
+
+/* returns non-zero if the path from the root to internal node <node> is made
+ * of less than 8 bits all set to one, meaning that the string may end there
+ * with a valid EOS padding.
+ */
+static int node_accepts(int node)
+{
+	int depth = 0;
+	int n = 0;
+
+	while (n != node && depth < 8) {
+		n = tree[n][1];
+		if (n < 0 || n >= 256)
+			return 0;
+		depth++;
+	}
+	return n == node && depth < 8;
+}
+
+/* dumps the nibble-driven FSM used by huff_dec_fsm(). States are the internal
+ * nodes of the huffman tree. For each state and each input nibble, the entry
+ * gives the next state, the flags and the emitted symbol if any. Since codes
+ * are at least 5 bits long, a nibble emits at most one symbol. Flags are :
+ *   - RHT_FSM_SYM    (1) : <sym> was emitted
+ *   - RHT_FSM_FAIL   (2) : EOS was found in the stream
+ *   - RHT_FSM_ACCEPT (4) : the stream may end in the next state
+ */
+static int gen_rht_fsm()
+{
+	int state, nib, bit, node, sym, flags;
+
+	if (build_tree() < 0 || tree_nodes != 256) {
+		fprintf(stderr, "unexpected huffman tree\n");
+		return 1;
+	}
+
+	printf("/* Nibble-driven huffman decoding FSM, generated by \"gen-rht -f\".\n");
+	printf(" * Do not edit, it is indexed on the state (internal tree node, 0 being\n");
+	printf(" * the root) then on the next input nibble, and gives { next state, flags,\n");
+	printf(" * symbol }. See gen-rht.c for the flags.\n");
+	printf(" */\n");
+	printf("#define RHT_FSM_SYM    1\n");
+	printf("#define RHT_FSM_FAIL   2\n");
+	printf("#define RHT_FSM_ACCEPT 4\n\n");
+	printf("static const struct rht_fsm rht_fsm[256][16] = {\n");
+
+	for (state = 0; state < 256; state++) {
+		printf("\t[0x%02x] = {", state);
+		for (nib = 0; nib < 16; nib++) {
+			node = state;
+			flags = sym = 0;
+			for (bit = 3; bit >= 0; bit--) {
+				node = tree[node][(nib >> bit) & 1];
+				if (node < 256)
+					continue;
+				if (node == 256 + 256)
+					flags |= RHT_FSM_FAIL_FLAG;
+				else {
+					flags |= RHT_FSM_SYM_FLAG;
+					sym = node - 256;
+				}
+				node = 0;
+			}
+			if (flags & RHT_FSM_FAIL_FLAG) {
+				/* stop on the root, nothing is emitted */
+				node = sym = 0;
+				flags = RHT_FSM_FAIL_FLAG;
+			}
+			else if (node_accepts(node))
+				flags |= RHT_FSM_ACCEPT_FLAG;
+			printf("%s{ 0x%02x, %d, 0x%02x },", (nib & 3) ? " " : "\n\t\t", node, flags, sym);
+		}
+		printf("\n\t},\n");
+	}
+	printf("};\n");
+	return 0;
+}
+
+/* names of the static table from RFC7541 Appendix A, [0] unused */
+static const char *sh_names[62] = {
+	[1] = ":authority", [2] = ":method", [3] = ":method", [4] = ":path",
+	[5] = ":path", [6] = ":scheme", [7] = ":scheme", [8] = ":status",
+	[9] = ":status", [10] = ":status", [11] = ":status", [12] = ":status",
+	[13] = ":status", [14] = ":status", [15] = "accept-charset",
+	[16] = "accept-encoding", [17] = "accept-language", [18] = "accept-ranges",
+	[19] = "accept", [20] = "access-control-allow-origin", [21] = "age",
+	[22] = "allow", [23] = "authorization", [24] = "cache-control",
+	[25] = "content-disposition", [26] = "content-encoding",
+	[27] = "content-language", [28] = "content-length",
+	[29] = "content-location", [30] = "content-range", [31] = "content-type",
+	[32] = "cookie", [33] = "date", [34] = "etag", [35] = "expect",
+	[36] = "expires", [37] = "from", [38] = "host", [39] = "if-match",
+	[40] = "if-modified-since", [41] = "if-none-match", [42] = "if-range",
+	[43] = "if-unmodified-since", [44] = "last-modified", [45] = "link",
+	[46] = "location", [47] = "max-forwards", [48] = "proxy-authenticate",
+	[49] = "proxy-authorization", [50] = "range", [51] = "referer",
+	[52] = "refresh", [53] = "retry-after", [54] = "server",
+	[55] = "set-cookie", [56] = "strict-transport-security",
+	[57] = "transfer-encoding", [58] = "user-agent", [59] = "vary",
+	[60] = "via", [61] = "www-authenticate",
+};
+
+/* the static table name hash key : the length and the first and last chars,
+ * made case-insensitive by setting bit 5 (only needs to be stable, the name is
+ * compared anyway). It must be the same as sh_hash_slot() below.
+ */
+static inline uint32_t sh_key(const char *n)
+{
+	size_t len = strlen(n);
+
+	return (len << 16) | ((n[0] | 0x20) << 8) | (n[len - 1] | 0x20);
+}
+
+/* dumps a perfect hash of the static table's names, giving for each name the
+ * first index and the number of consecutive indexes sharing this name. The
+ * slot is the upper <bits> of the key multiplied by an odd seed, and the
+ * smallest table and first pseudo-random seed without collision are used.
+ */
+static int gen_sh_hash()
+{
+	uint8_t slot_idx[256];
+	uint32_t seed = 0, rnd;
+	char name[40];
+	int bits, i, slot, end, tries;
+
+	for (i = 2; i < 62; i++) {
+		if (strcmp(sh_names[i], sh_names[i - 1]) == 0)
+			continue;
+		for (slot = 1; slot < i - 1; slot++) {
+			if (strcmp(sh_names[i], sh_names[slot]) == 0) {
+				fprintf(stderr, "name <%s> is not contiguous\n", sh_names[i]);
+				return 1;
+			}
+		}
+	}
+
+	for (bits = 6; bits <= 8; bits++) {
+		rnd = 2463534242U;
+		for (tries = 0; tries < 4000000; tries++) {
+			/* xorshift32, small seeds do not mix the key well enough */
+			rnd ^= rnd << 13;
+			rnd ^= rnd >> 17;
+			rnd ^= rnd << 5;
+			seed = rnd | 1;
+			memset(slot_idx, 0, sizeof(slot_idx));
+			for (i = 1; i < 62; i++) {
+				if (i > 1 && strcmp(sh_names[i], sh_names[i - 1]) == 0)
+					continue;
+				slot = (sh_key(sh_names[i]) * seed) >> (32 - bits);
+				if (slot_idx[slot])
+					break;
+				slot_idx[slot] = i;
+			}
+			if (i == 62)
+				goto found;
+		}
+	}
+	fprintf(stderr, "no perfect hash found\n");
+	return 1;
+
+ found:
+	printf("/* Perfect hash of the static table's names, generated by \"gen-rht -s\".\n");
+	printf(" * Do not edit. Each slot gives the name, its length, the first static table\n");
+	printf(" * index having this name and the number of consecutive indexes sharing it.\n");
+	printf(" */\n");
+	printf("#define SH_HASH_BITS %d\n", bits);
+	printf("#define SH_HASH_SEED 0x%08x\n\n", seed);
+
+	printf("static const struct sh_hash {\n");
+	printf("\tconst char *n;\n");
+	printf("\tuint8_t len;\n");
+	printf("\tuint8_t idx;\n");
+	printf("\tuint8_t cnt;\n");
+	printf("} sh_hash[1 << SH_HASH_BITS] = {\n");
+	for (slot = 0; slot < (1 << bits); slot++) {
+		i = slot_idx[slot];
+		if (!i)
+			continue;
+		for (end = i; end < 62 && strcmp(sh_names[end], sh_names[i]) == 0; end++)
+			;
+		snprintf(name, sizeof(name), "\"%s\",", sh_names[i]);
+		printf("\t[%3d] = { %-30s %2d, %2d, %d },\n", slot, name, (int)strlen(sh_names[i]), i, end - i);
+	}
+	printf("};\n\n");
+
+	printf("/* returns the hash slot of name <n> of length <len>, which must not be 0 */\n");
+	printf("static inline uint32_t sh_hash_slot(const char *n, size_t len)\n");
+	printf("{\n");
+	printf("\tuint32_t key = (len << 16) | ((n[0] | 0x20) << 8) | (n[len - 1] | 0x20);\n\n");
+	printf("\treturn (key * SH_HASH_SEED) >> (32 - SH_HASH_BITS);\n");
+	printf("}\n\n");
+
+	printf("/* looks up name <n> of length <len> in the static table. Returns the first\n");
+	printf(" * index having this name and sets <cnt> to the number of indexes sharing it,\n");
+	printf(" * or returns 0 if the name is not there.\n");
+	printf(" */\n");
+	printf("static inline int sh_lookup_name(const char *n, size_t len, int *cnt)\n");
+	printf("{\n");
+	printf("\tconst struct sh_hash *e;\n\n");
+	printf("\tif (!len)\n");
+	printf("\t\treturn 0;\n\n");
+	printf("\te = &sh_hash[sh_hash_slot(n, len)];\n");
+	printf("\tif (e->len != len || strncasecmp(n, e->n, len) != 0)\n");
+	printf("\t\treturn 0;\n\n");
+	printf("\t*cnt = e->cnt;\n");
+	printf("\treturn e->idx;\n");
+	printf("}\n");
 	return 0;
 }
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [-m [bits] | -c | -f | -s]\n"
+		"  no arg : dump the cascaded tables used by huff_dec()\n"
+		"  -m     : dump the multi-symbol table used by huff_dec_ms() (def: 11 bits)\n"
+		"  -c     : dump the canonical tables used by huff_dec_canon()\n"
+		"  -f     : dump the nibble FSM used by huff_dec_fsm()\n"
+		"  -s     : dump the perfect hash of the static table's names\n",
+		name);
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	int bits;
+
+	if (argc == 1) {
+		gen_rht_cascade();
+		return 0;
+	}
+
+	if (strcmp(argv[1], "-m") == 0) {
+		bits = (argc > 2) ? atoi(argv[2]) : 11;
+		if (bits < 5 || bits > 16)
+			usage(argv[0]);
+		gen_rht_ms(bits);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "-c") == 0)
+		return gen_rht_canon();
+
+	if (strcmp(argv[1], "-f") == 0)
+		return gen_rht_fsm();
+
+	if (strcmp(argv[1], "-s") == 0)
+		return gen_sh_hash();
+
+	usage(argv[0]);
+	return 1;
+}
@@ -0,0 +1,1066 @@
+/* HPACK decoder for experimentation purposes */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hpack-dec.h"
+#include "hpack-huff.h"
+#include "hpack-tbl.h"
+
+/* minimum size of the pool's trash buffers */
+#define TRASH_SIZE 16384
+
+/* shortest Huffman-encoded value of an indexed literal to be decoded straight
+ * into the dynamic table. Below this, reserving and trimming the room costs
+ * more than copying the decoded value.
+ */
+#define INPLACE_MIN 64
+
+/* returns non-zero if idx designates an entry of the static or dynamic table */
+static inline int idx_valid(const struct dht *dht, uint32_t idx)
+{
+	return idx <= HPACK_SH_SIZE + (uint32_t)dht->used;
+}
+
+/* takes an idx checked with idx_valid(), returns the associated name */
+static inline struct str idx_to_name(const struct dht *dht, uint32_t idx)
+{
+	if (idx <= HPACK_SH_SIZE)
+		return hpack_sh[idx].n;
+
+	return hpack_get_name(dht, hpack_get_dte(dht, idx - HPACK_SH_SIZE));
+}
+
+/* takes an idx checked with idx_valid(), returns the associated value */
+static inline struct str idx_to_value(const struct dht *dht, uint32_t idx)
+{
+	if (idx <= HPACK_SH_SIZE)
+		return hpack_sh[idx].v;
+
+	return hpack_get_value(dht, hpack_get_dte(dht, idx - HPACK_SH_SIZE));
+}
+
+/* dump the whole dynamic header table */
+__attribute__((used)) static void dht_dump(const struct dht *dht)
+{
+	int i;
+	unsigned int slot;
+	struct str name, value;
+
+	for (i = HPACK_SH_SIZE + 1; i <= HPACK_SH_SIZE + dht->used; i++) {
+		slot = (hpack_get_dte(dht, i - HPACK_SH_SIZE) - dht->dte);
+		name = idx_to_name(dht, i);
+		value = idx_to_value(dht, i);
+		fprintf(stderr, "idx=%d slot=%u name=<%.*s> value=<%.*s> addr=%u-%u\n",
+			i, slot,
+			(int)name.len, name.ptr,
+			(int)value.len, value.ptr,
+			dht->dte[slot].addr, dht->dte[slot].addr+dht->dte[slot].nlen+dht->dte[slot].vlen-1);
+	}
+}
+
+/* returns the CPU's time stamp counter, or 0 where it is not available */
+static inline uint64_t rdtsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/* inserts <name>:<value> into the context's dynamic table and accounts for it.
+ * Returns the same as dht_insert().
+ */
+static inline int dec_insert(struct hpack_dec_ctx *ctx, struct str name, struct str value)
+{
+	uint64_t cycles = 0;
+	int ret, bucket;
+
+	if (ctx->timing)
+		cycles = rdtsc();
+
+	if (ctx->incremental)
+		ret = dht_insert_inc(&ctx->dht, name, value, &ctx->alt);
+	else
+		ret = dht_insert(&ctx->dht, name, value, &ctx->alt);
+
+	if (ctx->timing) {
+		cycles = rdtsc() - cycles;
+		if (cycles > ctx->st.insert_cycles_max)
+			ctx->st.insert_cycles_max = cycles;
+		bucket = cycles ? 64 - __builtin_clzll(cycles) : 0;
+		ctx->st.insert_cycles_log2[bucket < 31 ? bucket : 31]++;
+	}
+
+	if (ret >= 0)
+		ctx->st.inserts++;
+	if (ret > 1)
+		ctx->st.defrags += ret - 1;
+	return ret;
+}
+
+/* applies a dynamic table size update to <size> bytes. The areas are only
+ * reallocated to grow beyond what was ever allocated, or to release them when
+ * the size drops to zero. Returns < 0 if <size> is larger than the maximum or
+ * if memory is missing.
+ */
+static int dec_resize(struct hpack_dec_ctx *ctx, uint32_t size)
+{
+	uint32_t alloc = size ? size : sizeof(struct dht);
+	uint32_t trash = size + 1 > TRASH_SIZE ? size + 1 : TRASH_SIZE;
+	struct dht *dht;
+
+	if (size > ctx->max_size)
+		return -1;
+
+	if (alloc > ctx->alloc) {
+		if (hpack_pool_reserve(ctx->pool, 0, trash) < 0)
+			return -1;
+		dht = realloc(ctx->dht, alloc);
+		if (!dht)
+			return -1;
+		ctx->dht = dht;
+		dht = realloc(ctx->alt, alloc);
+		if (!dht)
+			return -1;
+		ctx->alt = dht;
+		ctx->alloc = alloc;
+	}
+
+	dht_resize(&ctx->dht, &ctx->alt, size);
+
+	if (alloc < ctx->alloc && !size) {
+		/* the table is empty, keep only the heads */
+		if ((dht = realloc(ctx->dht, alloc)))
+			ctx->dht = dht;
+		if ((dht = realloc(ctx->alt, alloc)))
+			ctx->alt = dht;
+		ctx->alloc = alloc;
+	}
+	return 0;
+}
+
+/* field representations, from the first byte of a field */
+enum {
+	REP_ERR = 0,   /* invalid, indexed field with index zero */
+	REP_IDX,       /* indexed header field */
+	REP_LIT,       /* literal header field */
+	REP_UPD,       /* dynamic table size update */
+};
+
+/* literal field flags */
+#define REP_F_INDEX    0x01   /* with incremental indexing */
+#define REP_F_NEVER    0x02   /* never indexed */
+
+/* what the first byte of a field tells about it */
+struct rep {
+	uint8_t type;    /* REP_* */
+	uint8_t bits;    /* prefix bits of the index or size */
+	uint8_t flags;   /* REP_F_* for literals */
+};
+
+static const struct rep rep_tab[256] = {
+	[0x00 ... 0x0f] = { .type = REP_LIT, .bits = 4, .flags = 0           },
+	[0x10 ... 0x1f] = { .type = REP_LIT, .bits = 4, .flags = REP_F_NEVER },
+	[0x20 ... 0x3f] = { .type = REP_UPD, .bits = 5 },
+	[0x40 ... 0x7f] = { .type = REP_LIT, .bits = 6, .flags = REP_F_INDEX },
+	[0x80]          = { .type = REP_ERR, .bits = 7 },
+	[0x81 ... 0xff] = { .type = REP_IDX, .bits = 7 },
+};
+
+/* descriptions of the literals, indexed by their flags then by the presence
+ * of an indexed name.
+ */
+static const char *lit_desc[3][2] = {
+	[0]           = { "p17: literal without indexing", "p16: literal without indexing -- name" },
+	[REP_F_INDEX] = { "p16: literal with indexing",    "p15: literal with indexing -- name"    },
+	[REP_F_NEVER] = { "p18: literal never indexed",    "p17: literal never indexed -- name"    },
+};
+
+/* Per-block scratch area holding the strings which cannot be referenced in
+ * place : the Huffman-decoded ones, and the ones from the dynamic table that
+ * an insertion could evict or move. It spans both of the pool's trash buffers,
+ * which are contiguous, so that it is always large enough for all Huffman
+ * strings of a block, which expand by 8/5 at most.
+ */
+struct arena {
+	char *ptr;   /* first free byte */
+	char *end;   /* end of the area */
+};
+
+/* starts arena <a> over the trash buffers of <pool> */
+static inline void arena_init(struct arena *a, const struct hpack_pool *pool)
+{
+	a->ptr = pool->trash[0];
+	a->end = pool->trash[0] + 2 * pool->trash_size;
+}
+
+/* copies string <str> to arena <a> and makes it point to the copy. Returns < 0
+ * if the arena is full.
+ */
+static inline int arena_copy(struct arena *a, struct str *str)
+{
+	if ((size_t)(a->end - a->ptr) < str->len)
+		return -1;
+
+	memcpy(a->ptr, str->ptr, str->len);
+	str->ptr = a->ptr;
+	a->ptr += str->len;
+	return 0;
+}
+
+/* copies string <str> to arena <a> if it points into the dynamic table of
+ * <ctx>, and makes it point to the copy. Returns < 0 if the arena is full.
+ */
+static inline int arena_save(struct arena *a, const struct hpack_dec_ctx *ctx, struct str *str)
+{
+	if (str->ptr < (char *)ctx->dht || str->ptr >= (char *)ctx->dht + ctx->alloc)
+		return 0;
+	return arena_copy(a, str);
+}
+
+/* parses the length of the string literal at <*raw> (<*len> bytes left) into
+ * <*slen> and sets <*huff> if it is Huffman-encoded. <*raw> and <*len> are
+ * updated to the string itself. Returns 0 on success or -2 if the string is
+ * truncated.
+ */
+static inline int dec_str_len(const uint8_t **raw, uint32_t *len, uint32_t *slen, int *huff)
+{
+	if (!*len)
+		return -2;
+
+	*huff = **raw & 0x80;
+	*slen = get_var_int(raw, len, 7);
+	if (*len == (uint32_t)-1 || *len < *slen)
+		return -2;
+	return 0;
+}
+
+/* stores into <str> the string of <slen> bytes at <*raw> (<*len> bytes left),
+ * which is Huffman-encoded if <huff> is set. Raw strings are referenced in
+ * place, Huffman-encoded ones are decoded into arena <a>. <*raw> and <*len>
+ * are updated past the string. Returns 0 on success, -3 if the Huffman
+ * sequence is invalid, or -6 if the arena is full.
+ */
+static inline int dec_str_data(const uint8_t **raw, uint32_t *len, uint32_t slen, int huff,
+                               struct arena *a, struct str *str)
+{
+	int ret;
+
+	if (huff) {
+		ret = huff_decode(*raw, slen, a->ptr, a->end - a->ptr);
+		if (ret < 0)
+			return (a->end - a->ptr < slen * 8 / 5 + 1) ? -6 : -3;
+		*str = mkstr(a->ptr, ret);
+		a->ptr += ret;
+	} else {
+		*str = mkstr((const char *)*raw, slen);
+	}
+
+	*raw += slen;
+	*len -= slen;
+	return 0;
+}
+
+/* parses the string literal at <*raw> (<*len> bytes left) into <str>, see
+ * dec_str_data(). Returns 0 on success, -2 if the string is truncated, -3 if
+ * the Huffman sequence is invalid, or -6 if the arena is full.
+ */
+static inline int dec_str(const uint8_t **raw, uint32_t *len, struct arena *a, struct str *str)
+{
+	uint32_t slen;
+	int huff;
+	int ret;
+
+	if ((ret = dec_str_len(raw, len, &slen, &huff)) < 0)
+		return ret;
+	return dec_str_data(raw, len, slen, huff, a, str);
+}
+
+/* skips the string literal at <*raw> (<*len> bytes left) after checking that
+ * it is not truncated, and that its Huffman encoding is valid if it has one,
+ * without decoding it. Returns 0 on success, -2 if the string is truncated or
+ * -3 if the Huffman sequence is invalid.
+ */
+static inline int dec_str_skip(const uint8_t **raw, uint32_t *len)
+{
+	uint32_t slen;
+	int huff;
+	int ret;
+
+	if ((ret = dec_str_len(raw, len, &slen, &huff)) < 0)
+		return ret;
+	if (huff && huff_dec_len(*raw, slen) < 0)
+		return -3;
+	*raw += slen;
+	*len -= slen;
+	return 0;
+}
+
+/* parses the value of <slen> bytes at <*raw> (<*len> bytes left), which is
+ * Huffman-encoded if <huff> is set, of a literal with incremental indexing
+ * named <*name>, and inserts the field into the dynamic table of <ctx>. A
+ * long Huffman-encoded value is decoded straight into room reserved in the
+ * table after a copy of the name, for the largest length it may decode to,
+ * then the entry is trimmed to its real length and inserted in place.
+ * Otherwise the value is handled as other strings and then copied. On return
+ * <*name> and <*value> designate the new entry, or the decoded strings if it
+ * didn't fit. <*raw> and <*len> are updated past the value. Returns the same
+ * as dec_str_data(), or -9 if the name or value is too long for the table.
+ */
+static inline int dec_lit_insert(struct hpack_dec_ctx *ctx, const uint8_t **raw, uint32_t *len,
+                                 uint32_t slen, int huff, struct arena *a,
+                                 struct str *name, struct str *value)
+{
+	const struct dte *dte;
+	char *room = NULL;
+	int ret;
+
+	if (huff && slen >= INPLACE_MIN)
+		room = dht_reserve(ctx->dht, name->len + slen * 8 / 5);
+
+	if (room) {
+		memcpy(room, name->ptr, name->len);
+		ret = huff_decode(*raw, slen, room + name->len, slen * 8 / 5);
+		if (ret < 0)
+			return -3;
+		/* trim the entry by moving it to the end of the area, which
+		 * is still in cache, so that it leaves no hole in the table.
+		 */
+		memmove(room + slen * 8 / 5 - ret, room, name->len + ret);
+		room += slen * 8 / 5 - ret;
+		*name  = mkstr(room, name->len);
+		*value = mkstr(room + name->len, ret);
+		*raw += slen;
+		*len -= slen;
+		ctx->st.inplace++;
+	}
+	else {
+		if ((ret = dec_str_data(raw, len, slen, huff, a, value)) < 0)
+			return ret;
+		/* the name may be evicted */
+		if (arena_save(a, ctx, name) < 0)
+			return -6;
+	}
+
+	ret = dec_insert(ctx, *name, *value);
+	if (ret < 0)
+		return -9;
+	if (ret > 0) {
+		dte = hpack_get_dte(ctx->dht, 1);
+		*name  = hpack_get_name(ctx->dht, dte);
+		*value = hpack_get_value(ctx->dht, dte);
+	}
+	return 0;
+}
+
+/* prints the field starting with byte <c> of index or size <idx>, decoded into
+ * <*name> and <*value> unless it is a size update.
+ */
+static void dec_show(const struct hpack_dec_ctx *ctx, int c, uint32_t idx,
+                     const struct str *name, const struct str *value)
+{
+	const struct rep *rep = &rep_tab[c];
+
+	if (rep->type == REP_UPD)
+		printf("%02x: p18: dynamic table size update to %u\n", c, idx);
+	else if (rep->type == REP_IDX)
+		printf("%02x: p14: indexed header field\n  %.*s: %.*s\n", c,
+		       (int)name->len, name->ptr, (int)value->len, value->ptr);
+	else if (rep->flags & REP_F_INDEX)
+		printf("%02x: %s\n  %.*s: %.*s [used=%d]\n", c, lit_desc[rep->flags][!!idx],
+		       (int)name->len, name->ptr, (int)value->len, value->ptr, ctx->dht->used);
+	else
+		printf("%02x: %s\n  %.*s: %.*s\n", c, lit_desc[rep->flags][!!idx],
+		       (int)name->len, name->ptr, (int)value->len, value->ptr);
+}
+
+/* states of a block received in fragments, see struct hpack_dec_frag */
+enum {
+	FRAG_IDLE = 0, /* between blocks */
+	FRAG_FIELD,    /* at the start of a field */
+	FRAG_IDX,      /* in the index or size */
+	FRAG_NLEN,     /* in the name's length */
+	FRAG_NAME,     /* in the name */
+	FRAG_VLEN,     /* in the value's length */
+	FRAG_VALUE,    /* in the value */
+};
+
+/* reads the integer pending in <f> from <*raw> (<*len> bytes left), starting
+ * with its prefix byte if f->bits is set. <*raw> and <*len> are updated past
+ * what is consumed. Returns 1 once it is complete into f->val, 0 if all bytes
+ * were consumed before, or -1 if it is longer or larger than get_var_int()
+ * accepts.
+ */
+static int frag_int(struct hpack_dec_frag *f, const uint8_t **raw, uint32_t *len)
+{
+	uint64_t add;
+	uint8_t b;
+
+	while (*len) {
+		b = *(*raw)++;
+		(*len)--;
+		if (f->bits) {
+			f->val = b & ((1 << f->bits) - 1);
+			if (f->val < (1U << f->bits) - 1) {
+				f->bits = 0;
+				return 1;
+			}
+			f->bits = f->shift = 0;
+			continue;
+		}
+		if (f->shift >= 7 * VAR_INT_MAX_CONT)
+			return -1;
+		add = (uint64_t)(b & 127) << f->shift;
+		if (f->val + add > UINT32_MAX)
+			return -1;
+		f->val += add;
+		f->shift += 7;
+		if (!(b & 128))
+			return 1;
+	}
+	return 0;
+}
+
+/* makes sure the buffer of <f> holds at least <size> bytes. Returns < 0 if
+ * memory is missing.
+ */
+static int frag_grow(struct hpack_dec_frag *f, uint64_t size)
+{
+	char *buf;
+
+	if (f->buf && size <= f->buf_size)
+		return 0;
+
+	if (size > UINT32_MAX)
+		return -1;
+
+	buf = realloc(f->buf, size ? size : 1);
+	if (!buf)
+		return -1;
+	f->buf = buf;
+	f->buf_size = size;
+	return 0;
+}
+
+/* copies string <str> to arena <a> if it points into the buffer of <f>, which
+ * the next cut field will reuse. Returns < 0 if the arena is full.
+ */
+static inline int frag_save(struct arena *a, const struct hpack_dec_frag *f, struct str *str)
+{
+	if (str->ptr < f->buf || str->ptr >= f->buf + f->buf_size)
+		return 0;
+	return arena_copy(a, str);
+}
+
+/* continues the field pending in ctx->frag with the <*len> bytes at <*raw>,
+ * which are updated past what is consumed. Its strings are accumulated in the
+ * context's buffer until they are complete, then decoded as usual, and those
+ * still referencing the buffer are copied to arena <a>. Returns 1 once the
+ * header field is complete into <*name> and <*value>, 2 once a dynamic table
+ * size update was applied, 0 if all bytes were consumed before the end of the
+ * field, or < 0 on error, see hpack_dec_feed().
+ */
+static int dec_resume(struct hpack_dec_ctx *ctx, const uint8_t **raw, uint32_t *len,
+                      struct arena *a, struct str *name, struct str *value)
+{
+	struct hpack_dec_frag *f = &ctx->frag;
+	const struct rep *rep;
+	const uint8_t *str;
+	uint32_t n, off;
+	int ret;
+
+	while (1) {
+		switch (f->state) {
+		case FRAG_FIELD:
+			if (!*len)
+				return 0;
+			f->c = **raw;
+			f->bits = rep_tab[f->c].bits;
+			f->state = FRAG_IDX;
+			/* fall through */
+
+		case FRAG_IDX:
+			if ((ret = frag_int(f, raw, len)) <= 0)
+				return ret;
+
+			rep = &rep_tab[f->c];
+			f->idx = f->val;
+			if (rep->type == REP_ERR)
+				return -4;
+
+			if (rep->type == REP_UPD) {
+				if (f->seen)
+					return -35;
+				if (dec_resize(ctx, f->idx) < 0)
+					return -36;
+				f->state = FRAG_FIELD;
+				return 2;
+			}
+
+			if (f->idx && !idx_valid(ctx->dht, f->idx))
+				return -8;
+
+			f->seen = 1;
+			if (rep->type == REP_IDX) {
+				*name  = idx_to_name(ctx->dht, f->idx);
+				*value = idx_to_value(ctx->dht, f->idx);
+				f->state = FRAG_FIELD;
+				return 1;
+			}
+
+			/* literal, no insertion happens before its end so
+			 * an indexed name remains valid.
+			 */
+			f->bits = 7;
+			if (f->idx) {
+				f->name  = idx_to_name(ctx->dht, f->idx);
+				f->state = FRAG_VLEN;
+			}
+			else
+				f->state = FRAG_NLEN;
+			break;
+
+		case FRAG_NLEN:
+		case FRAG_VLEN:
+			if (f->bits && *len)
+				f->huff = **raw & 0x80;
+			if ((ret = frag_int(f, raw, len)) <= 0)
+				return ret;
+
+			f->slen = f->val;
+			f->have = 0;
+
+			/* a block passed at once must be smaller than the trash
+			 * buffers, and so must any string passed in fragments,
+			 * which also bounds the room reserved below.
+			 */
+			if (f->slen >= ctx->pool->trash_size)
+				return -2;
+
+			if (f->state == FRAG_NLEN) {
+				/* room for the name once decoded */
+				if (frag_grow(f, f->huff ? (uint64_t)f->slen * 8 / 5 : f->slen) < 0)
+					return -7;
+				f->state = FRAG_NAME;
+			}
+			else {
+				off = f->name.ptr ? 0 : f->name.len;
+				if (frag_grow(f, (uint64_t)off + f->slen) < 0)
+					return -7;
+				f->state = FRAG_VALUE;
+			}
+			break;
+
+		case FRAG_NAME:
+		case FRAG_VALUE:
+			off = (f->state == FRAG_VALUE && !f->name.ptr) ? f->name.len : 0;
+			n = f->slen - f->have;
+			if (n > *len)
+				n = *len;
+			memcpy(f->buf + off + f->have, *raw, n);
+			f->have += n;
+			*raw += n;
+			*len -= n;
+			if (f->have < f->slen)
+				return 0;
+
+			if (f->state == FRAG_NAME) {
+				/* keep the name at the beginning of the buffer */
+				if (f->huff) {
+					ret = huff_decode((const uint8_t *)f->buf, f->slen, a->ptr, a->end - a->ptr);
+					if (ret < 0)
+						return (a->end - a->ptr < f->slen * 8 / 5 + 1) ? -6 : -3;
+					memcpy(f->buf, a->ptr, ret);
+					f->name = mkstr(NULL, ret);
+				}
+				else
+					f->name = mkstr(NULL, f->slen);
+				f->bits = 7;
+				f->state = FRAG_VLEN;
+				break;
+			}
+
+			*name = f->name.ptr ? f->name : mkstr(f->buf, f->name.len);
+			str = (const uint8_t *)f->buf + off;
+			n = f->slen;
+			if (rep_tab[f->c].flags & REP_F_INDEX)
+				ret = dec_lit_insert(ctx, &str, &n, f->slen, f->huff, a, name, value);
+			else
+				ret = dec_str_data(&str, &n, f->slen, f->huff, a, value);
+			if (ret < 0)
+				return ret;
+
+			if (frag_save(a, f, name) < 0 || frag_save(a, f, value) < 0)
+				return -6;
+			f->state = FRAG_FIELD;
+			return 1;
+		}
+	}
+}
+
+/* decodes fragment <raw> of <len> bytes of a header block with context <ctx>,
+ * <last> being set for the block's last one, and stores the header fields it
+ * completes into <list> of <size> entries unless it is NULL. They are also
+ * printed unless ctx->quiet is set. Each field is classified by its first byte
+ * through rep_tab[], and all literals share the same parser.
+ *
+ * A block may be cut anywhere, even inside an integer or a string. The fields
+ * contained in a fragment are decoded in place, and only the last one, if it
+ * is cut, is kept in the context then completed with the next fragments : the
+ * part of its integer already read, its name, and the bytes of its string
+ * already received, which are copied.
+ *
+ * Names and values are not copied, they point to the static table, to the
+ * dynamic table or to <raw>. Only Huffman-decoded strings, dynamic table
+ * strings referenced before an insertion in the same fragment, and the
+ * strings of a field completed from previous fragments are copied to the
+ * thread's pool. Long Huffman-encoded values of literals with incremental
+ * indexing are decoded straight into the dynamic table when it has room for
+ * them. The list thus remains valid until the next call on this thread or the
+ * next change to the context's dynamic table, and as long as <raw> is.
+ *
+ * Returns the number of fields on success or < 0 on error, after which the
+ * block is abandoned :
+ *   -1 : truncated index or size
+ *   -2 : truncated string, or longer than the pool's trash buffers
+ *   -3 : invalid Huffman sequence
+ *   -4 : invalid index zero
+ *   -5 : more fields than <size>
+ *   -6 : not enough room in the pool for the copied strings
+ *   -7 : out of memory for a cut field
+ *   -8 : index past the static and dynamic tables
+ *   -9 : name or value to insert longer than DHT_STR_MAX
+ *  -34 : fragment at least as large as the pool's trash buffers
+ *  -35 : dynamic table size update after the first field
+ *  -36 : dynamic table size update above the maximum, or out of memory
+ */
+int hpack_dec_feed(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len, int last,
+                   struct hpack_hdr *list, int size)
+{
+	struct hpack_dec_frag *f = &ctx->frag;
+	const struct rep *rep;
+	const uint8_t *field = raw;
+	uint32_t field_len;
+	uint32_t idx;
+	uint32_t slen;
+	struct str name;
+	struct str value;
+	struct arena arena;
+	int c, ret, huff;
+	int nb = 0;     /* fields stored into <list> */
+	int saved = 0;  /* fields before this one don't reference the dht */
+	const uint8_t *upd_end = NULL;
+
+	/* no literal may be longer than the fragment, and the buffers are
+	 * always larger than any table entry.
+	 */
+	if (len >= ctx->pool->trash_size) {
+		ret = -34;
+		goto fail;
+	}
+
+	if (f->state == FRAG_IDLE) {
+		ctx->st.blocks++;
+		f->seen = 0;
+		f->state = FRAG_FIELD;
+	}
+	arena_init(&arena, ctx->pool);
+
+	if (f->state != FRAG_FIELD) {
+		/* complete the field cut by the previous fragment */
+		ret = dec_resume(ctx, &raw, &len, &arena, &name, &value);
+		if (ret < 0) {
+			/* the field is invalid, not cut */
+			f->state = FRAG_IDLE;
+			return ret;
+		}
+
+		if (!ret) {
+			if (!last)
+				return 0;
+			ret = (f->state == FRAG_IDX) ? -1 : -2;
+			goto fail;
+		}
+
+		if (!ctx->quiet)
+			dec_show(ctx, f->c, f->idx, &name, &value);
+
+		if (ret == 2) {
+			/* the pool may have been grown, nothing is stored yet */
+			arena_init(&arena, ctx->pool);
+		}
+		else {
+			ctx->st.fields++;
+			if (list) {
+				if (nb >= size) {
+					ret = -5;
+					goto fail;
+				}
+				list[nb].n = name;
+				list[nb].v = value;
+				nb++;
+			}
+		}
+	}
+	upd_end = f->seen ? NULL : raw;
+
+	while (len) {
+		field = raw;
+		field_len = len;
+		c = *raw;
+		rep = &rep_tab[c];
+		idx = c & ((1 << rep->bits) - 1);
+		if (idx < (1U << rep->bits) - 1) {
+			/* the index or size fits in the prefix */
+			raw++;
+			len--;
+		}
+		else {
+			idx = get_var_int(&raw, &len, rep->bits);
+			if (len == (uint32_t)-1) { // truncated
+				ret = -1;
+				goto fail;
+			}
+		}
+
+		if (rep->type != REP_UPD && idx && !idx_valid(ctx->dht, idx)) {
+			ret = -8;
+			goto fail;
+		}
+
+		switch (rep->type) {
+		case REP_IDX:
+			name  = idx_to_name(ctx->dht, idx);
+			value = idx_to_value(ctx->dht, idx);
+			break;
+
+		case REP_LIT:
+			if (idx)
+				name = idx_to_name(ctx->dht, idx);
+			else if ((ret = dec_str(&raw, &len, &arena, &name)) < 0)
+				goto fail;
+
+			if (rep->flags & REP_F_INDEX) {
+				/* the insertion may evict or move the entries
+				 * referenced so far.
+				 */
+				for (; saved < nb; saved++) {
+					if (arena_save(&arena, ctx, &list[saved].n) < 0 ||
+					    arena_save(&arena, ctx, &list[saved].v) < 0) {
+						ret = -6;
+						goto fail;
+					}
+				}
+
+				if ((ret = dec_str_len(&raw, &len, &slen, &huff)) < 0 ||
+				    (ret = dec_lit_insert(ctx, &raw, &len, slen, huff, &arena, &name, &value)) < 0)
+					goto fail;
+			}
+			else if ((ret = dec_str(&raw, &len, &arena, &value)) < 0)
+				goto fail;
+			break;
+
+		case REP_UPD:
+			/* max dyn table size change, only before the first field */
+			if (field != upd_end) {
+				ret = -35;
+				goto fail;
+			}
+			if (dec_resize(ctx, idx) < 0) {
+				ret = -36;
+				goto fail;
+			}
+			/* the pool may have been grown, nothing is stored yet */
+			arena_init(&arena, ctx->pool);
+			upd_end = raw;
+			if (!ctx->quiet)
+				dec_show(ctx, c, idx, &name, &value);
+			continue;
+
+		default:
+			ret = -4;
+			goto fail;
+		}
+
+		if (!ctx->quiet)
+			dec_show(ctx, c, idx, &name, &value);
+
+		ctx->st.fields++;
+		if (list) {
+			if (nb >= size) {
+				ret = -5;
+				goto fail;
+			}
+			list[nb].n = name;
+			list[nb].v = value;
+			nb++;
+		}
+	}
+
+	if (last)
+		f->state = FRAG_IDLE;
+	else if (upd_end != raw)
+		f->seen = 1;
+	return nb;
+
+ fail:
+	if ((ret == -1 || ret == -2) && !last) {
+		/* the field is cut, keep it for the next fragment */
+		f->seen = (upd_end != field);
+		f->state = FRAG_FIELD;
+		ret = dec_resume(ctx, &field, &field_len, &arena, &name, &value);
+		if (!ret)
+			return nb;
+	}
+	f->state = FRAG_IDLE;
+	return ret;
+}
+
+/* decodes the complete header block <raw> of <len> bytes with context <ctx>,
+ * see hpack_dec_feed().
+ */
+int hpack_dec_frame(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len,
+                    struct hpack_hdr *list, int size)
+{
+	return hpack_dec_feed(ctx, raw, len, 1, list, size);
+}
+
+/* decodes the complete header block <raw> of <len> bytes with context <ctx>,
+ * and reports each field to visitor <v> with argument <arg> instead of storing
+ * it. v->name() is called as soon as the field's name is known, and v->value()
+ * is called next only if it returned non-zero. The value of a literal with
+ * incremental indexing is always decoded since it enters the dynamic table,
+ * but the value of other literals that the visitor skips is not even decoded,
+ * and its Huffman encoding is thus not checked. Each field's strings are only
+ * valid during the callbacks. The fields are not printed. Must not be called
+ * while a block is fed with hpack_dec_feed().
+ *
+ * Returns the number of fields on success or < 0 on error, see
+ * hpack_dec_feed().
+ */
+int hpack_dec_visit(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len,
+                    const struct hpack_dec_visitor *v, void *arg)
+{
+	const struct rep *rep;
+	const uint8_t *field;
+	uint32_t idx;
+	uint32_t slen;
+	struct str name;
+	struct str value;
+	struct arena arena;
+	int c, ret, huff, want;
+	int nb = 0;
+	const uint8_t *upd_end = raw;
+
+	if (len >= ctx->pool->trash_size)
+		return -34;
+
+	ctx->st.blocks++;
+
+	while (len) {
+		field = raw;
+		c = *raw;
+		rep = &rep_tab[c];
+		idx = c & ((1 << rep->bits) - 1);
+		if (idx < (1U << rep->bits) - 1) {
+			/* the index or size fits in the prefix */
+			raw++;
+			len--;
+		}
+		else {
+			idx = get_var_int(&raw, &len, rep->bits);
+			if (len == (uint32_t)-1) // truncated
+				return -1;
+		}
+
+		/* nothing outlives a field */
+		arena_init(&arena, ctx->pool);
+
+		if (rep->type != REP_UPD && idx && !idx_valid(ctx->dht, idx))
+			return -8;
+
+		switch (rep->type) {
+		case REP_IDX:
+			name = idx_to_name(ctx->dht, idx);
+			if (v->name(arg, idx <= HPACK_SH_SIZE ? idx : 0, name))
+				v->value(arg, name, idx_to_value(ctx->dht, idx));
+			break;
+
+		case REP_LIT:
+			if (idx)
+				name = idx_to_name(ctx->dht, idx);
+			else if ((ret = dec_str(&raw, &len, &arena, &name)) < 0)
+				return ret;
+
+			want = v->name(arg, idx <= HPACK_SH_SIZE ? idx : 0, name);
+
+			if ((ret = dec_str_len(&raw, &len, &slen, &huff)) < 0)
+				return ret;
+
+			if (rep->flags & REP_F_INDEX) {
+				if ((ret = dec_lit_insert(ctx, &raw, &len, slen, huff, &arena, &name, &value)) < 0)
+					return ret;
+			}
+			else if (want) {
+				if ((ret = dec_str_data(&raw, &len, slen, huff, &arena, &value)) < 0)
+					return ret;
+			}
+			else {
+				/* skipped */
+				raw += slen;
+				len -= slen;
+			}
+
+			if (want)
+				v->value(arg, name, value);
+			break;
+
+		case REP_UPD:
+			/* max dyn table size change, only before the first field */
+			if (field != upd_end)
+				return -35;
+			if (dec_resize(ctx, idx) < 0)
+				return -36;
+			upd_end = raw;
+			continue;
+
+		default:
+			return -4;
+		}
+
+		ctx->st.fields++;
+		nb++;
+	}
+	return nb;
+}
+
+/* validates the complete header block <raw> of <len> bytes with context <ctx>
+ * without producing any field, eg to forward it unmodified. Only literals with
+ * incremental indexing are decoded, since they must be inserted into the
+ * dynamic table to keep it in sync with the peer's. Indexes are only checked
+ * against the tables' sizes, and the strings of other literals are only checked
+ * for a valid Huffman encoding, with the same rules as decoded ones. Must not be
+ * called while a block is fed with hpack_dec_feed().
+ *
+ * Returns the number of fields on success or < 0 on error, see
+ * hpack_dec_feed().
+ */
+int hpack_dec_validate(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len)
+{
+	const struct rep *rep;
+	const uint8_t *field;
+	uint32_t idx;
+	uint32_t slen;
+	struct str name;
+	struct str value;
+	struct arena arena;
+	int c, ret, huff;
+	int nb = 0;
+	const uint8_t *upd_end = raw;
+
+	if (len >= ctx->pool->trash_size)
+		return -34;
+
+	ctx->st.blocks++;
+
+	while (len) {
+		field = raw;
+		c = *raw;
+		rep = &rep_tab[c];
+		idx = c & ((1 << rep->bits) - 1);
+		if (idx < (1U << rep->bits) - 1) {
+			/* the index or size fits in the prefix */
+			raw++;
+			len--;
+		}
+		else {
+			idx = get_var_int(&raw, &len, rep->bits);
+			if (len == (uint32_t)-1) // truncated
+				return -1;
+		}
+
+		if (rep->type != REP_UPD && idx && !idx_valid(ctx->dht, idx))
+			return -8;
+
+		switch (rep->type) {
+		case REP_IDX:
+			break;
+
+		case REP_LIT:
+			if (!(rep->flags & REP_F_INDEX)) {
+				if (!idx && (ret = dec_str_skip(&raw, &len)) < 0)
+					return ret;
+				if ((ret = dec_str_skip(&raw, &len)) < 0)
+					return ret;
+				break;
+			}
+
+			arena_init(&arena, ctx->pool);
+			if (idx)
+				name = idx_to_name(ctx->dht, idx);
+			else if ((ret = dec_str(&raw, &len, &arena, &name)) < 0)
+				return ret;
+
+			if ((ret = dec_str_len(&raw, &len, &slen, &huff)) < 0)
+				return ret;
+			if ((ret = dec_lit_insert(ctx, &raw, &len, slen, huff, &arena, &name, &value)) < 0)
+				return ret;
+			break;
+
+		case REP_UPD:
+			/* max dyn table size change, only before the first field */
+			if (field != upd_end)
+				return -35;
+			if (dec_resize(ctx, idx) < 0)
+				return -36;
+			upd_end = raw;
+			continue;
+
+		default:
+			return -4;
+		}
+
+		ctx->st.fields++;
+		nb++;
+	}
+	return nb;
+}
+
+/* initializes decoder context <ctx> with an empty dynamic table of <size>
+ * bytes, and a second one it is swapped with after a defragmentation, instead
+ * of copying the rebuilt table back. <size> is also the largest size the peer
+ * may set, ctx->max_size may be raised afterwards to allow larger tables. The
+ * context uses the calling thread's pool, which is grown to suit the table.
+ * Returns < 0 on error.
+ */
+int hpack_dec_init(struct hpack_dec_ctx *ctx, uint32_t size)
+{
+	uint32_t trash = size + 1 > TRASH_SIZE ? size + 1 : TRASH_SIZE;
+
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->pool = hpack_pool_get();
+	if (hpack_pool_reserve(ctx->pool, 0, trash) < 0)
+		return -1;
+	ctx->dht = alloc_dht(size);
+	ctx->alt = alloc_dht(size);
+	if (!ctx->dht || !ctx->alt) {
+		hpack_dec_free(ctx);
+		return -1;
+	}
+	ctx->alloc = ctx->max_size = size;
+	return 0;
+}
+
+/* releases the resources allocated by hpack_dec_init() */
+void hpack_dec_free(struct hpack_dec_ctx *ctx)
+{
+	free(ctx->dht);
+	free(ctx->alt);
+	free(ctx->frag.buf);
+	ctx->dht = ctx->alt = NULL;
+	ctx->frag.buf = NULL;
+	ctx->frag.buf_size = 0;
+}
@@ -0,0 +1,74 @@
+/* HPACK decoder for experimentation purposes */
+
+#ifndef _HPACK_DEC_H
+#define _HPACK_DEC_H
+
+#include <stdint.h>
+#include "hpack-tbl.h"
+
+/* decoder statistics */
+struct hpack_dec_stats {
+	int blocks;    /* header blocks decoded */
+	int fields;    /* header fields decoded */
+	int inserts;   /* dynamic table insertions */
+	int inplace;   /* insertions with the value decoded in the table */
+	int defrags;   /* dynamic table defragmentations */
+	uint64_t insert_cycles_max;     /* slowest insertion, with <timing> */
+	int insert_cycles_log2[32];     /* insertions taking less than 2^n cycles */
+};
+
+/* state of a header block received in fragments, between two of them. A field
+ * cut by the end of a fragment is kept there until it is complete : the part
+ * of its integer already read, then its name, and the bytes of its string
+ * already received.
+ */
+struct hpack_dec_frag {
+	int state;               /* FRAG_*, FRAG_IDLE between blocks */
+	int seen;                /* 1 = a field other than a size update started */
+	uint8_t c;               /* first byte of the pending field */
+	uint8_t bits;            /* prefix bits of the integer, 0 once read */
+	uint8_t shift;           /* bits of the integer read after the prefix */
+	uint8_t huff;            /* the pending string is Huffman-encoded */
+	uint32_t val;            /* integer read so far */
+	uint32_t idx;            /* index or size of the pending field */
+	uint32_t slen;           /* length of the pending string */
+	uint32_t have;           /* bytes of the pending string in <buf> */
+	struct str name;         /* name of the pending literal, in <buf> if ptr is NULL */
+	char *buf;               /* the name then the string of the pending field */
+	uint32_t buf_size;       /* bytes allocated for <buf> */
+};
+
+/* a decoder context, one per connection */
+struct hpack_dec_ctx {
+	struct dht *dht;         /* dynamic table */
+	struct dht *alt;         /* same size, the next table after a defrag */
+	uint32_t alloc;          /* bytes allocated for each of dht and alt */
+	uint32_t max_size;       /* largest size the peer may set */
+	struct hpack_pool *pool; /* scratch space of the thread running it */
+	int incremental;         /* 1 = compact the table incrementally */
+	int timing;              /* 1 = measure insertion cycles */
+	int quiet;               /* 1 = don't print the fields */
+	struct hpack_dec_frag frag;
+	struct hpack_dec_stats st;
+};
+
+/* callbacks of hpack_dec_visit(). name() gets the index of the field's name in
+ * the static table, or zero, and the name, and returns non-zero to have value()
+ * called with the field's value.
+ */
+struct hpack_dec_visitor {
+	int (*name)(void *arg, uint32_t sidx, struct str name);
+	void (*value)(void *arg, struct str name, struct str value);
+};
+
+int hpack_dec_init(struct hpack_dec_ctx *ctx, uint32_t size);
+void hpack_dec_free(struct hpack_dec_ctx *ctx);
+int hpack_dec_frame(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len,
+                    struct hpack_hdr *list, int size);
+int hpack_dec_feed(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len, int last,
+                   struct hpack_hdr *list, int size);
+int hpack_dec_visit(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len,
+                    const struct hpack_dec_visitor *v, void *arg);
+int hpack_dec_validate(struct hpack_dec_ctx *ctx, const uint8_t *raw, uint32_t len);
+
+#endif
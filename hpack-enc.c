@@ -0,0 +1,674 @@
+/* HPACK encoder for experimentation purposes - certainly bogus.
+ *
+ * All the state of a connection lives in its struct hpack_enc_ctx, so that any
+ * number of connections may be encoded in parallel, one context per connection.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hpack-enc.h"
+#include "hpack-huff.h"
+#include "hpack-sh-hash.h"
+#include "hpack-tbl.h"
+
+#define debug_printf(l, f, ...)  do { if (ctx->debug >= (l)) printf((f), ##__VA_ARGS__); } while (0)
+
+/* hash index node of a dynamic table entry. Entries are designated by their
+ * insertion sequence number, which unlike dht slots survives defragmentation,
+ * and directly gives the HPACK index since the newest entry is index 1. Each
+ * entry is chained both in the bucket of its name and in the bucket of its
+ * name+value, newest first, so that the first match found in a chain is the
+ * most recent one. Evicted entries are not unlinked : they are always the
+ * oldest ones, so a chain simply ends at the first entry which is not in the
+ * table anymore. Nodes are reused in a ring since the table never holds more
+ * than size/32 entries. Sequence number 0 is never used and ends chains. Links
+ * are stored as the distance to the next older entry, which is still in the
+ * table when linked, so it is lower than the number of entries (at most 65535
+ * with struct dht), and 0 ends the chain.
+ */
+struct dyn_node {
+	uint32_t seq;      /* sequence number of the entry using this node */
+	uint16_t n_back;   /* distance to the next older entry with the same name hash */
+	uint16_t nv_back;  /* distance to the next older entry with the same name+value hash */
+};
+
+/* the encoder's dynamic table and its hash index, in a single allocation */
+struct dyn {
+	uint32_t ins;           /* number of insertions, seq of the newest entry */
+	uint32_t nodes;         /* number of nodes, size/32 */
+	uint32_t hmask;         /* number of hash buckets - 1 */
+	uint32_t *nb;           /* name buckets : newest seq or 0 */
+	uint32_t *nvb;          /* name+value buckets : newest seq or 0 */
+	struct dyn_node *node;  /* indexed on seq % nodes */
+	struct dht *dht;        /* the table's contents */
+};
+
+/* case-insensitive FNV-1a hash of string <s>, continuing from hash <h> */
+static inline uint32_t hash_str(uint32_t h, const char *s)
+{
+	uint8_t c;
+
+	while ((c = *s++)) {
+		if ((uint8_t)(c - 'A') < 26)
+			c += 'a' - 'A';
+		h = (h ^ c) * 16777619U;
+	}
+	return h;
+}
+
+#define HASH_INIT 2166136261U
+
+/* computes the name hash <nh> and name+value hash <nvh> of <n:v>. A separator
+ * is hashed between the name and the value so that "ab:c" and "a:bc" differ.
+ */
+static inline void hash_hdr(const char *n, const char *v, uint32_t *nh, uint32_t *nvh)
+{
+	*nh = hash_str(HASH_INIT, n);
+	*nvh = hash_str((*nh ^ ':') * 16777619U, v);
+}
+
+/* allocates a dynamic table of <size> bytes with its index. Returns NULL on
+ * error.
+ */
+static struct dyn *dyn_alloc(int size)
+{
+	uint32_t nodes = size / 32 ? size / 32 : 1;
+	uint32_t buckets = 1;
+	size_t idx_size;
+	struct dyn *dh;
+
+	while (buckets < nodes)
+		buckets <<= 1;
+
+	/* the index first, then the table, aligned */
+	idx_size = sizeof(*dh) + 2 * buckets * sizeof(*dh->nb) + nodes * sizeof(*dh->node);
+	idx_size = (idx_size + 7) & -8;
+
+	dh = calloc(1, idx_size + size);
+	if (!dh)
+		return NULL;
+
+	dh->nb = (uint32_t *)(dh + 1);
+	dh->nvb = dh->nb + buckets;
+	dh->node = (struct dyn_node *)(dh->nvb + buckets);
+	dh->dht = (struct dht *)((char *)dh + idx_size);
+	init_dht(dh->dht, size);
+	dh->hmask = buckets - 1;
+	dh->nodes = nodes;
+	return dh;
+}
+
+/* returns non-zero if the entry with sequence number <seq> is still in the
+ * table.
+ */
+static inline int dyn_alive(const struct dyn *dh, uint32_t seq)
+{
+	return dh->ins - seq < dh->dht->used && dh->node[seq % dh->nodes].seq == seq;
+}
+
+/* returns the sequence number of the next older entry in the name chain of
+ * the one with sequence number <seq>, or 0 if none.
+ */
+static inline uint32_t dyn_n_next(const struct dyn *dh, uint32_t seq)
+{
+	uint16_t back = dh->node[seq % dh->nodes].n_back;
+
+	return back ? seq - back : 0;
+}
+
+/* same as dyn_n_next() for the name+value chain */
+static inline uint32_t dyn_nv_next(const struct dyn *dh, uint32_t seq)
+{
+	uint16_t back = dh->node[seq % dh->nodes].nv_back;
+
+	return back ? seq - back : 0;
+}
+
+/* returns the HPACK index of the live entry with sequence number <seq> */
+static inline int seq_to_idx(const struct dyn *dh, uint32_t seq)
+{
+	return dh->ins - seq + 1;
+}
+
+/* inserts <n:v> into the dynamic table, using <alt> from hpack_pool_swap() to
+ * defragment it. The entry is not inserted if it is larger than the table, which
+ * is then left empty like the peer's.
+ */
+static void add_to_dyn(struct hpack_enc_ctx *ctx, const char *n, const char *v, struct dht *alt)
+{
+	struct dyn *dh = ctx->dh;
+	int ln = strlen(n);
+	int lv = strlen(v);
+	struct dyn_node *node;
+	struct dht *dht;
+	uint32_t nh, nvh, seq;
+	uint32_t *nb, *nvb;
+	int ret;
+
+	/* evicts the oldest entries if needed */
+	dht = dh->dht;
+	ret = dht_insert(&dht, mkstr(n, ln), mkstr(v, lv), &alt);
+	if (ret <= 0)
+		return;
+
+	if (ret > 1) {
+		/* The table shares its allocation with the index so it cannot
+		 * be swapped with the pool's area, it's copied back instead.
+		 */
+		if (dht != dh->dht)
+			memcpy(dh->dht, dht, dht->size);
+		ctx->st.defrags += ret - 1;
+	}
+
+	hash_hdr(n, v, &nh, &nvh);
+	seq = ++dh->ins;
+	node = &dh->node[seq % dh->nodes];
+	node->seq = seq;
+
+	nb = &dh->nb[nh & dh->hmask];
+	node->n_back = dyn_alive(dh, *nb) ? seq - *nb : 0;
+	*nb = seq;
+
+	nvb = &dh->nvb[nvh & dh->hmask];
+	node->nv_back = dyn_alive(dh, *nvb) ? seq - *nvb : 0;
+	*nvb = seq;
+}
+
+/* looks up <n:v> in the static table. Returns an index in the
+ * static table in <ni> or 0 if none was found. Returns the same
+ * index in <vi> if the value is the same, or 0 if the value
+ * differs (and has to be sent as a literal). Returns non-zero
+ * if an entry was found. This is the reference version which compares
+ * all entries.
+ */
+static int lookup_sh_linear(struct hpack_enc_ctx *ctx, const char *n, const char *v, int *ni, int *vi)
+{
+	unsigned int i;
+	int b = 0;
+
+	for (i = 1; i <= HPACK_SH_SIZE; i++) {
+		ctx->st.sh_cmps++;
+		if (strcasecmp(n, hpack_sh[i].n.ptr) == 0) {
+			ctx->st.sh_cmps++;
+			if (strcasecmp(v, hpack_sh[i].v.ptr) == 0) {
+				*ni = *vi = i;
+				return 1;
+			}
+			if (!b)
+				b = i;
+		}
+	}
+	if (!b)
+		return 0;
+	*ni = b;
+	*vi = 0;
+	return 1;
+}
+
+/* same as lookup_sh_linear() using the static table's perfect hash : the
+ * name is compared once, then only the values of the entries sharing this
+ * name are compared.
+ */
+static int lookup_sh(struct hpack_enc_ctx *ctx, const char *n, const char *v, int *ni, int *vi)
+{
+	int i, b, cnt;
+
+	if (ctx->linear_lookup)
+		return lookup_sh_linear(ctx, n, v, ni, vi);
+
+	ctx->st.sh_cmps++;
+	b = sh_lookup_name(n, strlen(n), &cnt);
+	if (!b)
+		return 0;
+
+	for (i = b; i < b + cnt; i++) {
+		ctx->st.sh_cmps++;
+		if (strcasecmp(v, hpack_sh[i].v.ptr) == 0) {
+			*ni = *vi = i;
+			return 1;
+		}
+	}
+	*ni = b;
+	*vi = 0;
+	return 1;
+}
+
+/* looks up <n:v> in the dynamic table. Returns an index in the
+ * dynamic table in <ni> or 0 if none was found. Returns the same
+ * index in <vi> if the value is the same, or 0 if the value
+ * differs (and has to be sent as a literal). Returns non-zero
+ * if an entry was found. This is the reference version which compares
+ * all entries from the newest to the oldest one.
+ */
+static int lookup_dh_linear(struct hpack_enc_ctx *ctx, const char *n, const char *v, int *ni, int *vi)
+{
+	struct dyn *dh = ctx->dh;
+	size_t ln = strlen(n);
+	size_t lv = strlen(v);
+	const struct dte *dte;
+	struct str name, value;
+	int i;
+	int b = 0;
+
+	for (i = 1; i <= dh->dht->used; i++) {
+		dte = hpack_get_dte(dh->dht, i);
+		name = hpack_get_name(dh->dht, dte);
+		if (name.len != ln || strncasecmp(n, name.ptr, ln) != 0)
+			continue;
+
+		value = hpack_get_value(dh->dht, dte);
+		if (value.len == lv && strncasecmp(v, value.ptr, lv) == 0) {
+			*ni = *vi = i;
+			return 1;
+		}
+		if (!b)
+			b = i;
+	}
+	if (!b)
+		return 0;
+
+	*ni = b;
+	*vi = 0;
+	return 1;
+}
+
+/* same as lookup_dh_linear() using the hash index : the name+value chain
+ * gives the most recent full match if any, otherwise the name chain gives the
+ * most recent name match.
+ */
+static int lookup_dh(struct hpack_enc_ctx *ctx, const char *n, const char *v, int *ni, int *vi)
+{
+	struct dyn *dh = ctx->dh;
+	size_t ln = strlen(n);
+	size_t lv = strlen(v);
+	const struct dte *dte;
+	struct str name, value;
+	uint32_t nh, nvh, seq;
+
+	if (ctx->linear_lookup)
+		return lookup_dh_linear(ctx, n, v, ni, vi);
+
+	hash_hdr(n, v, &nh, &nvh);
+
+	for (seq = dh->nvb[nvh & dh->hmask]; dyn_alive(dh, seq); seq = dyn_nv_next(dh, seq)) {
+		dte = hpack_get_dte(dh->dht, seq_to_idx(dh, seq));
+		name = hpack_get_name(dh->dht, dte);
+		value = hpack_get_value(dh->dht, dte);
+		if (name.len == ln && value.len == lv &&
+		    strncasecmp(n, name.ptr, ln) == 0 && strncasecmp(v, value.ptr, lv) == 0) {
+			*ni = *vi = seq_to_idx(dh, seq);
+			return 1;
+		}
+	}
+
+	for (seq = dh->nb[nh & dh->hmask]; dyn_alive(dh, seq); seq = dyn_n_next(dh, seq)) {
+		dte = hpack_get_dte(dh->dht, seq_to_idx(dh, seq));
+		name = hpack_get_name(dh->dht, dte);
+		if (name.len == ln && strncasecmp(n, name.ptr, ln) == 0) {
+			*ni = seq_to_idx(dh, seq);
+			*vi = 0;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* appends byte <b> to the header block. Returns the number of bytes emitted. */
+static int send_byte(struct hpack_enc_ctx *ctx, uint8_t b)
+{
+	ctx->out[ctx->out_len++] = b;
+	ctx->st.output_bytes++;
+	return 1;
+}
+
+/* encodes <v> on <b> bits using a variable encoding, and OR the first byte
+ * with byte <o>. The whole integer is written at once when there are at least
+ * 8 bytes left in the output buffer. Returns the number of bytes emitted.
+ */
+static int send_var_int(struct hpack_enc_ctx *ctx, uint8_t o, uint32_t v, int b)
+{
+	int sent;
+
+	if (ctx->out_size - ctx->out_len >= 8)
+		sent = put_var_int_wide(ctx->out + ctx->out_len, o, v, b);
+	else
+		sent = put_var_int(ctx->out + ctx->out_len, o, v, b);
+	ctx->out_len += sent;
+	ctx->st.output_bytes += sent;
+	ctx->st.output_ints++;
+	ctx->st.output_int_bytes += sent;
+	return sent;
+}
+
+/* returns the number of bytes emitted. The string is huffman-encoded straight
+ * into the header block with the raw length as the budget so that encoding
+ * stops as soon as it is known not to be worth it, in which case it is copied
+ * instead.
+ */
+static int encode_string(struct hpack_enc_ctx *ctx, const char *s)
+{
+	int slen = strlen(s);
+	uint8_t *p = ctx->out + ctx->out_len;
+	int plen, sent;
+
+	ctx->st.input_str_bytes += slen;
+
+	sent = hpack_enc_str(s, slen, p);
+	ctx->out_len += sent;
+	ctx->st.output_bytes += sent;
+
+	/* length of the length prefix */
+	plen = 1;
+	if ((*p & 0x7f) == 0x7f)
+		while (p[plen++] & 0x80)
+			;
+	ctx->st.output_ints++;
+	ctx->st.output_int_bytes += plen;
+
+	if (*p & 0x80) {
+		ctx->st.output_huf_enc++;
+		ctx->st.output_huf_bytes += sent - plen;
+	} else {
+		ctx->st.output_raw_enc++;
+		ctx->st.output_raw_bytes += sent - plen;
+	}
+	return sent;
+}
+
+static int send_static(struct hpack_enc_ctx *ctx, int idx)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent = send_var_int(ctx, 0x80, idx, 7); break;
+	case 1: sent = send_var_int(ctx, 0x80, idx, 6); break;
+	case 2: sent = send_var_int(ctx, 0x30, idx, 4); break;
+	case 3: sent = send_var_int(ctx, 0x80, idx, 6); break;
+	}
+	ctx->st.output_static++;
+	ctx->st.output_static_bytes += sent;
+	debug_printf(1, "  => %s(%d) = %d\n", __FUNCTION__, idx, sent);
+	return sent;
+}
+
+static int send_dynamic(struct hpack_enc_ctx *ctx, int idx)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent = send_var_int(ctx, 0x80, idx + HPACK_SH_SIZE, 7); break;
+	case 1: sent = send_var_int(ctx, 0xC0, idx, 6); break;
+	case 2: sent = send_var_int(ctx, 0x40, idx, 6); break;
+	case 3: sent = send_var_int(ctx, 0xC0, idx, 6); break;
+	}
+	ctx->st.output_dynamic++;
+	ctx->st.output_dynamic_bytes += sent;
+	debug_printf(1, "  => %s(%d) = %d\n", __FUNCTION__, idx, sent);
+	return sent;
+}
+
+static int send_static_literal(struct hpack_enc_ctx *ctx, int idx, const char *v)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent += send_var_int(ctx, 0x40, idx, 6); break;
+	case 1: sent += send_var_int(ctx, 0x40, idx, 5); break;
+	case 2: sent += send_var_int(ctx, 0x80, idx, 6); break;
+	case 3: sent += send_var_int(ctx, 0x40, idx, 4); break;
+	}
+	sent += encode_string(ctx, v);
+	ctx->st.output_static_lit++;
+	ctx->st.output_static_lit_bytes += sent;
+	debug_printf(1, "  => %s(%d, '%s') = %d\n", __FUNCTION__, idx, v, sent);
+	return sent;
+}
+
+static int send_dynamic_literal(struct hpack_enc_ctx *ctx, int idx, const char *v)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent += send_var_int(ctx, 0x40, idx + HPACK_SH_SIZE, 6); break;
+	case 1: sent += send_var_int(ctx, 0x60, idx, 5); break;
+	case 2: sent += send_var_int(ctx, 0xC0, idx, 6); break;
+	case 3: sent += send_var_int(ctx, 0x50, idx, 4); break;
+	}
+	sent += encode_string(ctx, v);
+	ctx->st.output_dynamic_lit++;
+	ctx->st.output_dynamic_lit_bytes += sent;
+	debug_printf(1, "  => %s(%d, '%s') = %d\n", __FUNCTION__, idx, v, sent);
+	return sent;
+}
+
+static int send_literal(struct hpack_enc_ctx *ctx, const char *n, const char *v)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent += send_byte(ctx, 0x40); break;
+	case 1: sent += send_byte(ctx, 0x40); break;
+	case 2: sent += send_byte(ctx, 0x80); break;
+	case 3: sent += send_byte(ctx, 0x50); break;
+	}
+	sent += encode_string(ctx, n);
+	sent += encode_string(ctx, v);
+	ctx->st.output_literal++;
+	debug_printf(1, "  => %s('%s', '%s') = %d\n", __FUNCTION__, n, v, sent);
+	return sent;
+}
+
+static int send_static_literal_wo(struct hpack_enc_ctx *ctx, int idx, const char *v)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent += send_var_int(ctx, 0x00, idx, 4); break;
+	case 1: sent += send_var_int(ctx, 0x00, idx, 3); break;
+	case 2: sent += send_var_int(ctx, 0x00, idx, 3); break;
+	case 3: sent += send_var_int(ctx, 0x20, idx, 4); break;
+	}
+	sent += encode_string(ctx, v);
+	ctx->st.output_static_lit_wo++;
+	ctx->st.output_static_lit_wo_bytes += sent;
+	debug_printf(1, "  => %s(%d, '%s') = %d\n", __FUNCTION__, idx, v, sent);
+	return sent;
+}
+
+static int send_dynamic_literal_wo(struct hpack_enc_ctx *ctx, int idx, const char *v)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent += send_var_int(ctx, 0x00, idx + HPACK_SH_SIZE, 4); break;
+	case 1: sent += send_var_int(ctx, 0x08, idx, 3); break;
+	case 2: sent += send_var_int(ctx, 0x08, idx, 3); break;
+	case 3: sent += send_var_int(ctx, 0x30, idx, 4); break;
+	}
+	sent += encode_string(ctx, v);
+	ctx->st.output_dynamic_lit_wo++;
+	ctx->st.output_dynamic_lit_wo_bytes += sent;
+	debug_printf(1, "  => %s(%d, '%s') = %d\n", __FUNCTION__, idx, v, sent);
+	return sent;
+}
+
+static int send_literal_wo(struct hpack_enc_ctx *ctx, const char *n, const char *v)
+{
+	int sent = 0;
+
+	switch(ctx->proposal) {
+	case 0: sent += send_byte(ctx, 0x00); break;
+	case 1: sent += send_byte(ctx, 0x00); break;
+	case 2: sent += send_byte(ctx, 0x00); break;
+	case 3: sent += send_byte(ctx, 0x30); break;
+	}
+	sent += encode_string(ctx, n);
+	sent += encode_string(ctx, v);
+	ctx->st.output_literal_wo++;
+	debug_printf(1, "  => %s('%s', '%s') = %d\n", __FUNCTION__, n, v, sent);
+	return sent;
+}
+
+/* encodes header field <n:v> into the context's header block. Returns the
+ * number of bytes emitted, or < 0 on error, in which case nothing is emitted :
+ *   -1 : not enough room left in the header block
+ *   -2 : out of memory for the area the dynamic table is defragmented into
+ */
+int hpack_enc_hdr(struct hpack_enc_ctx *ctx, const char *n, const char *v)
+{
+	int sn = 0, sv = 0; /* static name, value indexes */
+	int dn = 0, dv = 0; /* dynamic name, value indexes */
+	struct dht *alt = NULL;
+	int dont_index;
+	int sent;
+
+	/* worst case : a 5-byte index, and both strings with a 5-byte length */
+	if (ctx->out_size - ctx->out_len < strlen(n) + strlen(v) + 16)
+		return -1;
+
+	debug_printf(1, "\nname=<%s> value=<%s>\n", n, v);
+
+	lookup_sh(ctx, n, v, &sn, &sv);
+	lookup_dh(ctx, n, v, &dn, &dv);
+
+	debug_printf(2, "  stat_idx=%d stat_v=%d dyn_idx=%d dyn_v=%d\n", sn, sv, dn, dv);
+
+	/* decide whether or not we have to index this one */
+	dont_index = 0;
+	if (sn && sn == sv) /* indexed static */
+		dont_index = 1;
+
+	if (dn && dn == dv) /* indexed dynamic */
+		dont_index = 1;
+
+	/* don't index :path which changes a lot */
+	switch (sn) {
+	case 4: dont_index = 1; /* :path */
+	}
+
+	/* the table cannot store longer names or values */
+	if (strlen(n) > DHT_STR_MAX || strlen(v) > DHT_STR_MAX)
+		dont_index = 1;
+
+	/* our fixed custom headers have a name starting with "xxxx". The
+	 * fixed one have a value starting with "yyyy", we can index them.
+	 * The other "xxxx" one are variable and not indexed by the producer.
+	 * A client will have these two lines, but a gateway will not.
+	 */
+	//if (strncmp(n, "xxxx", 4) == 0 && strncmp(v, "yyyy", 4) != 0)
+	//	dont_index = 1;
+
+	/* the peer will insert an indexed literal, so it may only be sent once
+	 * we're sure to insert it as well. The pool was grown to suit the table
+	 * by hpack_enc_init(), but may have been released since.
+	 */
+	if (!dont_index) {
+		alt = hpack_pool_swap(ctx->pool, ctx->dh->dht->size);
+		if (!alt)
+			return -2;
+	}
+
+	/* now send the best encoding */
+
+	if (sn && sn == sv)
+		sent = send_static(ctx, sn);
+	else if (dn && dn == dv)
+		sent = send_dynamic(ctx, dn);
+	else if (sn && (!dn || sn <= dn) && !dont_index)
+		sent = send_static_literal(ctx, sn, v);
+	else if (dn && (!sn || dn <= sn) && !dont_index)
+		sent = send_dynamic_literal(ctx, dn, v);
+	else if (sn && (!dn || sn <= dn) && dont_index)
+		sent = send_static_literal_wo(ctx, sn, v);
+	else if (dn && (!sn || dn <= sn) && dont_index)
+		sent = send_dynamic_literal_wo(ctx, dn, v);
+	else if (!dont_index)
+		sent = send_literal(ctx, n, v);
+	else
+		sent = send_literal_wo(ctx, n, v);
+
+	if (!dont_index) {
+		add_to_dyn(ctx, n, v, alt);
+		debug_printf(2, "  used=%d ; head=%d\n", ctx->dh->dht->used, ctx->dh->dht->head);
+	}
+	return sent;
+}
+
+/* starts a new header block in buffer <out> of <size> bytes */
+void hpack_enc_start(struct hpack_enc_ctx *ctx, uint8_t *out, unsigned int size)
+{
+	ctx->out = out;
+	ctx->out_size = size;
+	ctx->out_len = 0;
+}
+
+/* initializes encoder context <ctx> with an empty dynamic table of <size>
+ * bytes, the default settings and null statistics. The context uses the
+ * calling thread's pool, which is grown to suit the table. Returns < 0 on
+ * error.
+ */
+int hpack_enc_init(struct hpack_enc_ctx *ctx, int size)
+{
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->pool = hpack_pool_get();
+	if (hpack_pool_reserve(ctx->pool, size, 0) < 0)
+		return -1;
+	ctx->dh = dyn_alloc(size);
+	if (!ctx->dh)
+		return -1;
+	ctx->st.allocs++;
+	return 0;
+}
+
+/* empties the dynamic table of <ctx> so that it may be reused for a new
+ * connection, without reallocating it. Settings and statistics are kept.
+ */
+void hpack_enc_reset(struct hpack_enc_ctx *ctx)
+{
+	struct dyn *dh = ctx->dh;
+
+	memset(dh->nb, 0, 2 * (dh->hmask + 1) * sizeof(*dh->nb));
+	memset(dh->node, 0, dh->nodes * sizeof(*dh->node));
+	dh->ins = 0;
+	init_dht(dh->dht, dh->dht->size);
+	hpack_enc_start(ctx, NULL, 0);
+}
+
+/* releases the resources allocated by hpack_enc_init() */
+void hpack_enc_free(struct hpack_enc_ctx *ctx)
+{
+	free(ctx->dh);
+	ctx->dh = NULL;
+}
+
+/* adds statistics <src> to <dst> */
+void hpack_enc_stats_add(struct hpack_enc_stats *dst, const struct hpack_enc_stats *src)
+{
+	dst->input_str_bytes             += src->input_str_bytes;
+	dst->output_bytes                += src->output_bytes;
+	dst->output_ints                 += src->output_ints;
+	dst->output_int_bytes            += src->output_int_bytes;
+	dst->output_huf_bytes            += src->output_huf_bytes;
+	dst->output_huf_enc              += src->output_huf_enc;
+	dst->output_raw_bytes            += src->output_raw_bytes;
+	dst->output_raw_enc              += src->output_raw_enc;
+	dst->output_static               += src->output_static;
+	dst->output_static_bytes         += src->output_static_bytes;
+	dst->output_dynamic              += src->output_dynamic;
+	dst->output_dynamic_bytes        += src->output_dynamic_bytes;
+	dst->output_static_lit           += src->output_static_lit;
+	dst->output_static_lit_bytes     += src->output_static_lit_bytes;
+	dst->output_dynamic_lit          += src->output_dynamic_lit;
+	dst->output_dynamic_lit_bytes    += src->output_dynamic_lit_bytes;
+	dst->output_literal              += src->output_literal;
+	dst->output_static_lit_wo        += src->output_static_lit_wo;
+	dst->output_static_lit_wo_bytes  += src->output_static_lit_wo_bytes;
+	dst->output_dynamic_lit_wo       += src->output_dynamic_lit_wo;
+	dst->output_dynamic_lit_wo_bytes += src->output_dynamic_lit_wo_bytes;
+	dst->output_literal_wo           += src->output_literal_wo;
+	dst->sh_cmps                     += src->sh_cmps;
+	dst->allocs                      += src->allocs;
+	dst->defrags                     += src->defrags;
+}
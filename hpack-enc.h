@@ -0,0 +1,61 @@
+/* HPACK encoder for experimentation purposes */
+
+#ifndef _HPACK_ENC_H
+#define _HPACK_ENC_H
+
+#include <stdint.h>
+
+/* encoder statistics */
+struct hpack_enc_stats {
+	int input_str_bytes;
+	int output_bytes;
+	int output_ints;
+	int output_int_bytes;
+	int output_huf_bytes;
+	int output_huf_enc;
+	int output_raw_bytes;
+	int output_raw_enc;
+	int output_static;
+	int output_static_bytes;
+	int output_dynamic;
+	int output_dynamic_bytes;
+	int output_static_lit;
+	int output_static_lit_bytes;
+	int output_dynamic_lit;
+	int output_dynamic_lit_bytes;
+	int output_literal;
+	int output_static_lit_wo;
+	int output_static_lit_wo_bytes;
+	int output_dynamic_lit_wo;
+	int output_dynamic_lit_wo_bytes;
+	int output_literal_wo;
+	int sh_cmps;   /* static table comparisons */
+	int allocs;    /* memory allocations */
+	int defrags;   /* dynamic table defragmentations */
+};
+
+/* the dynamic table and its index, private to the encoder */
+struct dyn;
+struct hpack_pool;
+
+/* an encoder context, one per connection */
+struct hpack_enc_ctx {
+	struct dyn *dh;         /* dynamic table */
+	struct hpack_pool *pool; /* scratch space of the thread running it */
+	int proposal;           /* 0 = draft09 (default), 1="option3", 2="Tue, 21 Oct 2014 11:40:32 +0200", 3=Greg's */
+	int debug;              /* 0 = none, 1 = encoding, 2 = code */
+	int linear_lookup;      /* table lookups : 0 = hashed (default), 1 = linear scan */
+	uint8_t *out;           /* header block being built */
+	unsigned int out_size;  /* size of the <out> buffer */
+	unsigned int out_len;   /* bytes emitted into <out> */
+	struct hpack_enc_stats st;
+};
+
+int hpack_enc_init(struct hpack_enc_ctx *ctx, int size);
+void hpack_enc_reset(struct hpack_enc_ctx *ctx);
+void hpack_enc_free(struct hpack_enc_ctx *ctx);
+void hpack_enc_start(struct hpack_enc_ctx *ctx, uint8_t *out, unsigned int size);
+int hpack_enc_hdr(struct hpack_enc_ctx *ctx, const char *n, const char *v);
+void hpack_enc_stats_add(struct hpack_enc_stats *dst, const struct hpack_enc_stats *src);
+
+#endif
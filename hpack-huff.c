@@ -1,6 +1,13 @@
 #include <stdio.h>
+#include <limits.h>
 #include <stdint.h>
 #include <string.h>
+#include <arpa/inet.h>
+#include <endian.h>
+#include "hpack-huff.h"
+
+#define likely(x)   __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
 
 struct huff {
 	uint32_t c; /* code point */
@@ -12,6 +19,18 @@ struct rht {
 	uint8_t l; // length in bits
 };
 
+struct rht_fsm {
+	uint8_t state; // next state
+	uint8_t flags; // RHT_FSM_*
+	uint8_t sym;   // emitted symbol if flags & RHT_FSM_SYM
+};
+
+struct rht_ms {
+	uint8_t c[2]; // up to two codes
+	uint8_t l1;   // length in bits of the first code, 0 if none
+	uint8_t l;    // length in bits of all codes
+};
+
 /* huffman table as per RFC7541 appendix B */
 static const struct huff ht[257] = {
 	[  0] = { .c = 0x00001ff8, .b = 13 },
@@ -1353,150 +1372,870 @@ struct rht rht_bit11_4[256] = {
 	/* Note, when l==30, bits 2..3 give 00:0x0a, 01:0x0d, 10:0x16, 11:EOS */
 };
 
-/* huffman-encode string <s> into the huff_tmp buffer and returns the amount
- * of output bytes. The caller must ensure the output is large enough (ie at
- * least 4 times as long as s).
+/* multi-symbol table, see gen-rht -m */
+#include "hpack-rht-ms.h"
+
+/* canonical decoding tables, see gen-rht -c */
+#include "hpack-rht-canon.h"
+
+/* nibble-driven FSM, see gen-rht -f */
+#include "hpack-rht-fsm.h"
+
+/* Refills the 64-bit window <win> holding <avail> MSB-aligned valid bits from
+ * the stream at <huff>, without going past <huff_end>. Bits past the end of the
+ * stream are zeroes (and not ones) so that we can distinguish shifted bits from
+ * a really inserted EOS. As long as 8 bytes are left, a single unaligned big
+ * endian read is performed, all the whole bytes fitting in the window are
+ * consumed and the next partial byte is read again next time. It leaves at
+ * least 56 bits in the window, which is enough for any code. The last 7 bytes
+ * are read one at a time.
+ */
+static inline void huff_refill(uint64_t *win, int *avail, const uint8_t **huff, const uint8_t *huff_end)
+{
+	uint64_t word;
+
+	if (likely(*huff + 8 <= huff_end)) {
+		memcpy(&word, *huff, 8);
+		*win |= be64toh(word) >> *avail;
+		*huff += (63 - *avail) >> 3;
+		*avail |= 56;
+		return;
+	}
+
+	while (*avail <= 56 && *huff < huff_end) {
+		*win |= (uint64_t)*(*huff)++ << (56 - *avail);
+		*avail += 8;
+	}
+}
+
+/* checks the <bleft> bits of the stream left after the last decoded symbol,
+ * whose first <avail> ones are in window <win>. They must be a strict prefix of
+ * EOS (ie: less than 8 ones), otherwise either the string contains an EOS or
+ * an invalid padding, or the output was too short to hold all its symbols. The
+ * window is refilled first since a decoder which stopped on a full output did
+ * not refill it after its last symbol. Returns 0 if they are valid, otherwise
+ * -1.
+ */
+static inline int huff_check_pad(uint64_t win, int avail, const uint8_t *huff, const uint8_t *huff_end, int bleft)
+{
+	if (!bleft)
+		return 0;
+	if (bleft >= 8)
+		return -1;
+	huff_refill(&win, &avail, &huff, huff_end);
+	return ((uint32_t)(win >> 32) | ~0U >> bleft) == ~0U ? 0 : -1;
+}
+
+/* looks up the symbol whose code starts at the MSB of <code> in the cascaded
+ * reverse-huffman tables. Returns its length in bits after setting <sym>, or
+ * zero if no valid symbol is found (ie: EOS).
+ */
+static inline int huff_dec_sym(uint32_t code, uint8_t *sym)
+{
+	if ((code >> 24) < 0xfe) {
+		/* single byte */
+		*sym = rht_bit31_24[code >> 24].c;
+		return rht_bit31_24[code >> 24].l;
+	}
+	else if (((code >> 17) & 0xff) < 0xff) {
+		/* two bytes, 0xfe + 2 bits or 0xff + 2..7 bits */
+		*sym = rht_bit24_17[(code >> 17) & 0xff].c;
+		return rht_bit24_17[(code >> 17) & 0xff].l;
+	}
+	else if (((code >> 16) & 0xff) < 0xff) { /* 3..5 bits */
+		/* 0xff + 0xfe + 3..5 bits or
+		 * 0xff + 0xff + 5..8 bits for values till 0xf5
+		 */
+		*sym = rht_bit15_11_fe[(code >> 11) & 0x1f].c;
+		return rht_bit15_11_fe[(code >> 11) & 0x1f].l;
+	}
+	else if (((code >> 8) & 0xff) < 0xf6) { /* 5..8 bits */
+		/* that's 0xff + 0xff */
+		*sym = rht_bit15_8[(code >> 8) & 0xff].c;
+		return rht_bit15_8[(code >> 8) & 0xff].l;
+	}
+
+	/* 0xff 0xff 0xf6..0xff */
+	if (rht_bit11_4[(code >> 4) & 0xff].l < 30)
+		*sym = rht_bit11_4[(code >> 4) & 0xff].c;
+	else if ((code & 0xff) == 0xf0)
+		*sym = 10;
+	else if ((code & 0xff) == 0xf4)
+		*sym = 13;
+	else if ((code & 0xff) == 0xf8)
+		*sym = 22;
+	else // 0xfc : EOS
+		return 0;
+	return rht_bit11_4[(code >> 4) & 0xff].l;
+}
+
+/* looks up the symbol whose code starts at the MSB of <code> using the
+ * canonical property of the code : the number of leading ones gives the
+ * shortest possible length, and at most RHT_CANON_MAX_STEPS extra lengths have
+ * to be checked against their upper limit. Note that a branchless version of
+ * these checks was measured twice as slow, because it places all the lookups
+ * on the critical path while the branches let the CPU speculate on the length.
+ * Returns the length in bits after setting <sym>, or zero if no valid symbol
+ * is found (ie: EOS).
+ */
+static inline int huff_dec_canon_sym(uint32_t code, uint8_t *sym)
+{
+	int l;
+
+	if (unlikely(code >= RHT_CANON_EOS))
+		return 0;
+
+	l = rht_canon_start[__builtin_clz(~code)];
+	while (code >= rht_canon_limit[l])
+		l++;
+
+	*sym = rht_canon_sym[rht_canon_ofs[l] + ((code - rht_canon_limit[l - 1]) >> (32 - l))];
+	return l;
+}
+
+/* code lengths of the 128 ASCII characters, arranged by high then low nibble for
+ * the vectorized length estimators. They are those of ht[] above, and
+ * huff-bench checks that the estimators agree with the scalar one.
+ */
+static const uint8_t huff_len_tbl[8][16] __attribute__((aligned(16))) = {
+	{ 13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28 },
+	{ 28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28 },
+	{  6, 10, 10, 12, 13,  6,  8, 11, 10, 10,  8, 11,  8,  6,  6,  6 },
+	{  5,  5,  5,  6,  6,  6,  6,  6,  6,  6,  7,  8, 15,  6, 12, 10 },
+	{ 13,  6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7 },
+	{  7,  7,  7,  7,  7,  7,  7,  7,  8,  7,  8, 13, 19, 13, 14,  6 },
+	{ 15,  5,  6,  5,  6,  5,  6,  6,  6,  5,  7,  7,  6,  6,  6,  5 },
+	{  6,  7,  6,  5,  5,  6,  7,  7,  7,  7,  7, 15, 11, 14, 13, 28 },
+};
+
+/* returns the exact number of bits needed to huffman-encode the <len> bytes
+ * of <s>, one byte at a time.
+ */
+static uint32_t huff_len_bits_scalar(const uint8_t *s, int len)
+{
+	uint32_t bits = 0;
+
+	while (len-- > 0)
+		bits += ht[*s++].b;
+	return bits;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+/* Vectorized versions of huff_len_bits_scalar(), 16 or 32 bytes at a time.
+ * The code length of each byte is looked up in huff_len_tbl[] using PSHUFB on
+ * the low nibble, once per high nibble. The high nibble is selected by XORing
+ * it then adding 0x70 with saturation : the bytes from the selected row get
+ * 0x70 to 0x7f which index the table, and the other ones get bit 7 set which
+ * makes PSHUFB return zero. Since only ASCII is handled this way, 8 rows are
+ * enough, and blocks containing bytes >= 0x80 (rare) are counted by the scalar
+ * version. Lengths are at most 30 so the per-byte sums never overflow, and
+ * they are accumulated into 64-bit words using PSADBW. Strings shorter than a
+ * vector and the tails are passed to the scalar version. Note that the AVX2
+ * version must never call the SSSE3 one : mixing legacy SSE and VEX encodings
+ * costs hundreds of cycles per transition on some CPUs.
+ */
+__attribute__((target("ssse3")))
+static uint32_t huff_len_bits_ssse3(const uint8_t *s, int len)
+{
+	const __m128i bias = _mm_set1_epi8(0x70);
+	__m128i acc = _mm_setzero_si128();
+	__m128i tbl[8];
+	__m128i v, idx, lens;
+	uint32_t bits = 0;
+	int h;
+
+	if (len < 16)
+		return huff_len_bits_scalar(s, len);
+
+	for (h = 0; h < 8; h++)
+		tbl[h] = _mm_load_si128((const __m128i *)huff_len_tbl[h]);
+
+	for (; len >= 16; s += 16, len -= 16) {
+		v = _mm_loadu_si128((const __m128i *)s);
+		if (unlikely(_mm_movemask_epi8(v))) {
+			bits += huff_len_bits_scalar(s, 16);
+			continue;
+		}
+
+		lens = _mm_setzero_si128();
+		for (h = 0; h < 8; h++) {
+			idx  = _mm_adds_epu8(_mm_xor_si128(v, _mm_set1_epi8(h << 4)), bias);
+			lens = _mm_add_epi8(lens, _mm_shuffle_epi8(tbl[h], idx));
+		}
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(lens, _mm_setzero_si128()));
+	}
+
+	bits += _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+	return bits + huff_len_bits_scalar(s, len);
+}
+
+__attribute__((target("avx2")))
+static uint32_t huff_len_bits_avx2(const uint8_t *s, int len)
+{
+	const __m256i bias = _mm256_set1_epi8(0x70);
+	__m256i acc = _mm256_setzero_si256();
+	__m256i tbl[8];
+	__m256i v, idx, lens;
+	__m128i acc128;
+	uint32_t bits = 0;
+	int h;
+
+	if (len < 32)
+		return huff_len_bits_scalar(s, len);
+
+	for (h = 0; h < 8; h++)
+		tbl[h] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i *)huff_len_tbl[h]));
+
+	for (; len >= 32; s += 32, len -= 32) {
+		v = _mm256_loadu_si256((const __m256i *)s);
+		if (unlikely(_mm256_movemask_epi8(v))) {
+			bits += huff_len_bits_scalar(s, 32);
+			continue;
+		}
+
+		lens = _mm256_setzero_si256();
+		for (h = 0; h < 8; h++) {
+			idx  = _mm256_adds_epu8(_mm256_xor_si256(v, _mm256_set1_epi8(h << 4)), bias);
+			lens = _mm256_add_epi8(lens, _mm256_shuffle_epi8(tbl[h], idx));
+		}
+		acc = _mm256_add_epi64(acc, _mm256_sad_epu8(lens, _mm256_setzero_si256()));
+	}
+
+	acc128 = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	bits += _mm_cvtsi128_si32(acc128) + _mm_cvtsi128_si32(_mm_srli_si128(acc128, 8));
+	return bits + huff_len_bits_scalar(s, len);
+}
+
+static int cpu_has_ssse3() { return __builtin_cpu_supports("ssse3"); }
+static int cpu_has_avx2()  { return __builtin_cpu_supports("avx2"); }
+#endif
+
+/* all available length estimators, with the shortest string length each one
+ * is picked for, or -1 if it is never picked. The scalar version is faster
+ * than the vector ones on short strings, and the SSSE3 one never wins against
+ * it since it needs 8 lookups per 16 bytes (1.1 vs 1.4 GB/s at 64 bytes, 1.2
+ * vs 1.4 GB/s at 4 kB). The AVX2 one is even with it at 32 bytes, wins from 64
+ * bytes (1.9 GB/s) and is about twice as fast from 256 bytes.
+ */
+const struct huff_len_engine huff_len_engines[] = {
+	{ "scalar", huff_len_bits_scalar, NULL,          0 },
+#if defined(__x86_64__) || defined(__i386__)
+	{ "ssse3",  huff_len_bits_ssse3,  cpu_has_ssse3, -1 },
+	{ "avx2",   huff_len_bits_avx2,   cpu_has_avx2,  64 },
+#endif
+	{ NULL,     NULL,                 NULL,          0 },
+};
+
+static uint32_t huff_len_bits_init(const uint8_t *s, int len);
+
+/* the estimator used for strings of at least huff_len_vec_min bytes, which is
+ * zero until huff_len_bits_init() picks it on the first call.
+ */
+static uint32_t (*huff_len_bits_vec)(const uint8_t *s, int len) = huff_len_bits_init;
+static int huff_len_vec_min;
+
+/* picks for long strings the last supported engine with a positive minimum
+ * length, or the scalar one if there is none, then calls it. It is only called
+ * once.
+ */
+static uint32_t huff_len_bits_init(const uint8_t *s, int len)
+{
+	const struct huff_len_engine *engine;
+
+	huff_len_bits_vec = huff_len_bits_scalar;
+	huff_len_vec_min = INT_MAX;
+	for (engine = huff_len_engines; engine->name; engine++) {
+		if (engine->min_len > 0 && (!engine->supported || engine->supported())) {
+			huff_len_bits_vec = engine->len;
+			huff_len_vec_min = engine->min_len;
+		}
+	}
+
+	return huff_len_bits(s, len);
+}
+
+/* returns the exact number of bits needed to huffman-encode the <len> bytes of
+ * <s>, using the fastest available estimator for this length.
+ */
+uint32_t huff_len_bits(const uint8_t *s, int len)
+{
+	if (len < huff_len_vec_min)
+		return huff_len_bits_scalar(s, len);
+	return huff_len_bits_vec(s, len);
+}
+
+/* returns the number of bytes needed to huffman-encode the <len> bytes of <s>,
+ * without emitting anything, for callers which need to know it before encoding.
+ * Note that hpack_enc_str() doesn't, see there why.
+ */
+int huff_enc_len(const char *s, int len)
+{
+	return (huff_len_bits((const uint8_t *)s, len) + 7) / 8;
+}
+
+/* huffman-encode string <s> into buffer <out> and returns the amount of output
+ * bytes. The caller must ensure the output is large enough (ie at least 4 times
+ * as long as s).
  *
- * FIXME: bits are only counted for now, no code is emitted!
+ * Codes are appended to the LSB of a 64-bit accumulator, which holds less than
+ * 32 pending bits between two symbols. Since a code is at most 30 bits long, it
+ * never overflows, and as soon as 32 bits or more are pending, the 32 oldest
+ * ones are flushed at once as a big endian word. The remaining bits are flushed
+ * byte by byte at the end, and the last byte is padded with the EOS prefix (all
+ * ones) as mandated by RFC7541#5.2.
  */
 int huff_enc(const char *s, char *out)
 {
-	int bits = 0;
+	const char *out_start = out;
+	uint64_t acc = 0;
+	uint32_t word;
+	int bits = 0; /* pending bits in acc */
 
 	while (*s) {
+		acc = (acc << ht[(uint8_t)*s].b) + ht[(uint8_t)*s].c;
 		bits += ht[(uint8_t)*s].b;
 		s++;
+
+		if (bits >= 32) {
+			bits -= 32;
+			word = htonl(acc >> bits);
+			memcpy(out, &word, 4);
+			out += 4;
+		}
+	}
+
+	while (bits >= 8) {
+		bits -= 8;
+		*out++ = acc >> bits;
+	}
+
+	if (bits)
+		*out++ = (acc << (8 - bits)) | (0xff >> bits);
+
+	return out - out_start;
+}
+
+/* huffman-encode the <len> bytes of string <s> into buffer <out>, which must
+ * be at least <max> bytes long, and returns the amount of output bytes. This
+ * works like huff_enc() except that it stops and returns -1 as soon as the
+ * output is known to exceed <max> bytes, without ever writing past <max>.
+ * Passing the raw length minus one for <max> thus stops encoding strings which
+ * do not benefit from huffman-encoding (tokens, base64 cookies) at the first
+ * flush past the budget, instead of encoding them fully to discard the result.
+ */
+int huff_enc_max(const char *s, int len, char *out, int max)
+{
+	const uint8_t *p = (const uint8_t *)s;
+	const uint8_t *end = p + len;
+	const char *out_start = out;
+	const char *out_end = out + max;
+	uint64_t acc = 0;
+	uint32_t word;
+	int bits = 0; /* pending bits in acc */
+
+	while (p < end) {
+		acc = (acc << ht[*p].b) + ht[*p].c;
+		bits += ht[*p].b;
+		p++;
+
+		if (bits >= 32) {
+			if (unlikely(out_end - out < 4))
+				return -1;
+			bits -= 32;
+			word = htonl(acc >> bits);
+			memcpy(out, &word, 4);
+			out += 4;
+		}
+	}
+
+	if ((bits + 7) / 8 > out_end - out)
+		return -1;
+
+	while (bits >= 8) {
+		bits -= 8;
+		*out++ = acc >> bits;
+	}
+
+	if (bits)
+		*out++ = (acc << (8 - bits)) | (0xff >> bits);
+
+	return out - out_start;
+}
+
+/* returns the number of bytes needed to encode <v> on <b> bits using the
+ * HPACK variable integer encoding.
+ */
+static inline int var_int_len(uint32_t v, int b)
+{
+	int len = 1;
+
+	if (v < (uint32_t)((1 << b) - 1))
+		return len;
+
+	v -= (1 << b) - 1;
+	while (v >= 128) {
+		v >>= 7;
+		len++;
+	}
+	return len + 1;
+}
+
+/* spreads the 32 lowest bits of <v> into groups of 7 bits at the bottom of
+ * each byte, lowest group first. This is what pdep with 0x7f7f7f7f7f would
+ * do, in 3 steps of shifts and masks.
+ */
+static inline uint64_t var_int_spread(uint64_t v)
+{
+	v = (v & 0x000000000fffffffULL) | ((v << 4) & 0x0fffffff00000000ULL);
+	v = (v & 0x00003fff00003fffULL) | ((v << 2) & 0x3fff00003fff0000ULL);
+	v = (v & 0x007f007f007f007fULL) | ((v << 1) & 0x7f007f007f007f00ULL);
+	return v;
+}
+
+/* the reverse of var_int_spread(), gathers the 7 lowest bits of each byte of
+ * <v> into a 56-bit value, as pext with 0x7f7f7f7f7f7f7f7f would do.
+ */
+static inline uint64_t var_int_gather(uint64_t v)
+{
+	v &= 0x7f7f7f7f7f7f7f7fULL;
+	v = (v & 0x007f007f007f007fULL) | ((v & 0x7f007f007f007f00ULL) >> 1);
+	v = (v & 0x00003fff00003fffULL) | ((v & 0x3fff00003fff0000ULL) >> 2);
+	v = (v & 0x000000000fffffffULL) | ((v & 0x0fffffff00000000ULL) >> 4);
+	return v;
+}
+
+/* encodes <v> on <b> bits into <out> using the HPACK variable integer encoding,
+ * and OR the first byte with byte <o>. Returns the number of bytes written.
+ */
+int put_var_int(uint8_t *out, uint8_t o, uint32_t v, int b)
+{
+	uint8_t *start = out;
+
+	if (v < (uint32_t)((1 << b) - 1)) {
+		*out++ = o | v;
+		return 1;
+	}
+
+	*out++ = o | ((1 << b) - 1);
+	v -= (1 << b) - 1;
+	while (v >= 128) {
+		*out++ = 128 | (v & 127);
+		v >>= 7;
+	}
+	*out++ = v;
+	return out - start;
+}
+
+/* same as put_var_int() except that <out> must have room for 8 bytes. All the
+ * continuation bytes are built in a 64-bit word, with the continuation bit set
+ * on all of them but the last one, and written at once together with the
+ * first byte, so that there is no loop depending on the value.
+ */
+int put_var_int_wide(uint8_t *out, uint8_t o, uint32_t v, int b)
+{
+	uint64_t word;
+	int n;
+
+	if (v < (uint32_t)((1 << b) - 1)) {
+		*out = o | v;
+		return 1;
+	}
+
+	v -= (1 << b) - 1;
+	if (likely(v < 128)) {
+		/* a single continuation byte is the most common case */
+		out[0] = o | ((1 << b) - 1);
+		out[1] = v;
+		return 2;
+	}
+
+	/* number of 7-bit groups, at least two */
+	n = (32 - __builtin_clz(v) + 6) / 7;
+	word = var_int_spread(v) | (0x8080808080ULL & ((1ULL << (8 * n - 8)) - 1));
+	word = (word << 8) | (uint8_t)(o | ((1 << b) - 1));
+	word = htole64(word);
+	memcpy(out, &word, 8);
+	return n + 1;
+}
+
+/* reads a varint from <raw>'s lowest <b> bits and <len> bytes max (raw included).
+ * returns the 32-bit value on success after updating raw_in and len_in. Forces
+ * len_in to (uint32_t)-1 on truncated input, and on integers with more than
+ * VAR_INT_MAX_CONT continuation bytes or larger than 32 bits. As long as 8
+ * bytes follow the first one, the continuation bytes are loaded at once and the
+ * last one is found from the missing continuation bits. Shorter tails and
+ * integers larger than 8 bytes are read one byte at a time.
+ */
+uint32_t get_var_int(const uint8_t **raw_in, uint32_t *len_in, int b)
+{
+	uint64_t ret = 0;
+	int len = *len_in;
+	const uint8_t *raw = *raw_in;
+	uint8_t shift = 0;
+	uint64_t word, stop;
+	int n;
+
+	len--;
+	ret = *(raw++) & ((1 << b) - 1);
+	if (ret != (uint32_t)((1 << b) - 1))
+		goto end;
+
+	/* a single continuation byte is the most common case */
+	if (likely(len) && !(*raw & 128)) {
+		ret += *raw++;
+		len--;
+		goto end;
+	}
+
+	if (likely(len >= 8)) {
+		memcpy(&word, raw, 8);
+		word = le64toh(word);
+		stop = ~word & 0x8080808080808080ULL;
+		if (likely(stop)) {
+			/* keep the bytes up to and including the first one
+			 * without the continuation bit.
+			 */
+			n = (__builtin_ctzll(stop) + 1) >> 3;
+			if (n > VAR_INT_MAX_CONT)
+				goto too_short;
+			ret += var_int_gather(word & (stop ^ (stop - 1)));
+			raw += n;
+			len -= n;
+			goto check;
+		}
+		goto too_short;
+	}
+
+	while (1) {
+		if (!len)
+			goto too_short;
+		if (!(*raw & 128))
+			break;
+		if (shift >= 7 * (VAR_INT_MAX_CONT - 1))
+			goto too_short;
+		ret += ((uint64_t)(*raw++) & 127) << shift;
+		shift += 7;
+		len--;
 	}
-	bits += 7;
 
-	memset(out, 'H', bits / 8); /*  FIXME: huffman code is not emitted yet. */
-	return bits / 8;
+	/* last 7 bits */
+	if (!len)
+		goto too_short;
+	len--;
+	ret += ((uint64_t)(*raw++) & 127) << shift;
+
+ check:
+	if (ret > UINT32_MAX)
+		goto too_short;
+ end:
+	*raw_in = raw;
+	*len_in = len;
+	return ret;
+
+ too_short:
+	*len_in = (uint32_t)-1;
+	return 0;
+}
+
+/* emits the <len> bytes of string <s> as an HPACK string literal (RFC7541#5.2)
+ * into <out>, which must have room for at least <len> + 5 bytes. The string is
+ * huffman-encoded straight after the room reserved for the raw length prefix,
+ * with the raw length as the budget. If it does not fit, the raw string simply
+ * replaces it behind the raw prefix. Otherwise the huffman prefix is written,
+ * and since it can only be shorter, the encoded string is moved back if needed.
+ * The length is not counted first with huff_len_bits() : this costs more than
+ * it saves on strings which compress, ie almost all header values (eg: 452 vs
+ * 338 MB/s for 64 alphanumeric bytes, 482 vs 454 MB/s for 1 kB), and only
+ * pays off on binary ones. Returns the number of bytes written.
+ */
+int hpack_enc_str(const char *s, int len, uint8_t *out)
+{
+	int plen = var_int_len(len, 7);
+	int hplen;
+	int hlen;
+
+	hlen = huff_enc_max(s, len, (char *)out + plen, len - 1);
+	if (hlen < 0) {
+		put_var_int(out, 0x00, len, 7);
+		memcpy(out + plen, s, len);
+		return plen + len;
+	}
+
+	hplen = var_int_len(hlen, 7);
+	if (hplen < plen)
+		memmove(out + hplen, out + plen, hlen);
+	put_var_int(out, 0x80, hlen, 7);
+	return hplen + hlen;
 }
 
 /* pass a huffman string, it will decode it and return the new output size or
- * -1 in case of error.
+ * -1 in case of error, ie if it contains EOS, if its padding is not a strict
+ * prefix of EOS (see huff_check_pad()), or if the output is too short.
  *
  * The principle of the decoder is to lookup full bytes in reverse-huffman
  * tables. Since we may need up to 30 bits and the word positions are not
- * always multiples of 8, we build the code word by shifting the "current"
- * 32-bit word and the "next" one of the appropriate amount of bits. Once
- * the shift goes beyond 32, words are swapped and the "next" one is refilled
- * with new bytes. Shift operations are cheap when done a single time like this.
- * On 64-bit platforms it is possible to further improve this by storing both
- * of them in a single word.
- * 
+ * always multiples of 8, the stream is kept MSB-aligned in a 64-bit window
+ * which is refilled by huff_refill() before each lookup, and shifted by the
+ * code length after each lookup. This way the code always lies in the upper
+ * 32 bits of the window.
  */
 int huff_dec(const uint8_t *huff, int hlen, char *out, int olen)
 {
 	char *out_start = out;
 	char *out_end = out + olen;
 	const uint8_t *huff_end = huff + hlen;
-	uint32_t curr = 0;
-	uint32_t next = 0;
-	uint32_t shift;
-	uint32_t code; /* The 30-bit code being looked up, MSB-aligned */
-	uint8_t sym;
+	uint64_t win = 0;
+	uint32_t code = 0; /* The 30-bit code being looked up, MSB-aligned */
+	uint8_t sym = 0;
+	int avail = 0; /* valid bits in win */
 	int bleft; /* bits left */
 	int l;
 
-	code = 0;
-	shift = 64; // start with an empty buffer
 	bleft = hlen << 3;
 	while (bleft > 0 && out != out_end) {
-		while (shift >= 32) {
-			curr = next;
+		huff_refill(&win, &avail, &huff, huff_end);
 
-			/* read up to 4 bytes into next. FIXME: this should
-			 * later be optimized to perform a single 32-bit big
-			 * endian read when unaligned accesses are possible.
-			 */
-			next = 0;
+		/* now we necessarily have 32 bits available */
+		code = win >> 32;
+		l = huff_dec_sym(code, &sym);
 
-			if (huff + 4 <= huff_end) {
-				next = (huff[0] << 24) + (huff[1] << 16) + (huff[2] <<  8) + huff[3];
-				huff += 4;
-			}
-			else {
-				/* note: we append 0 and not 0xff so that we can
-				 * distinguish shifted bits from a really inserted
-				 * EOS.
-				 */
-				next =  (((huff + 0 < huff_end) ? huff[0] : 0x00) << 24) +
-					(((huff + 1 < huff_end) ? huff[1] : 0x00) << 16) +
-					(((huff + 2 < huff_end) ? huff[2] : 0x00) <<  8) +
-					((huff + 3 < huff_end) ? huff[3] : 0x00);
-				huff = huff_end;
-			}
+		if (!l || bleft - l < 0)
+			break;
 
-			shift -= 32;
-		}
+		bleft -= l;
+		avail -= l;
+		win <<= l;
+		*out++ = sym;
+	}
 
-		/* curr:next contain 64 bit of huffman code */
-		code = curr;
-		if (shift)
-			code = (code << shift) + (next >> (32 - shift));
+	if (huff_check_pad(win, avail, huff, huff_end, bleft) < 0)
+		return -1;
 
-		/* now we necessarily have 32 bits available */
-		if ((code >> 24) < 0xfe) {
-			/* single byte */
-			l = rht_bit31_24[code >> 24].l;
-			sym = rht_bit31_24[code >> 24].c;
-		}
-		else if (((code >> 17) & 0xff) < 0xff) {
-			/* two bytes, 0xfe + 2 bits or 0xff + 2..7 bits */
-			l = rht_bit24_17[(code >> 17) & 0xff].l;
-			sym = rht_bit24_17[(code >> 17) & 0xff].c;
-		}
-		else if (((code >> 16) & 0xff) < 0xff) { /* 3..5 bits */
-			/* 0xff + 0xfe + 3..5 bits or
-			 * 0xff + 0xff + 5..8 bits for values till 0xf5
+	if (out < out_end)
+		*out = 0; // end of string whenever possible
+	return out - out_start;
+}
+
+/* Same as huff_dec() above, except that the symbols are only counted and not
+ * emitted, for callers which only need to validate a string they don't keep.
+ * Returns the decoded length, or -1 if the sequence is invalid.
+ */
+int huff_dec_len(const uint8_t *huff, int hlen)
+{
+	const uint8_t *huff_end = huff + hlen;
+	uint64_t win = 0;
+	uint32_t code = 0; /* The 30-bit code being looked up, MSB-aligned */
+	uint8_t sym;
+	int avail = 0; /* valid bits in win */
+	int bleft; /* bits left */
+	int l, n = 0;
+
+	bleft = hlen << 3;
+	while (bleft > 0) {
+		huff_refill(&win, &avail, &huff, huff_end);
+
+		code = win >> 32;
+		l = huff_dec_sym(code, &sym);
+		if (!l || bleft - l < 0)
+			break;
+
+		bleft -= l;
+		avail -= l;
+		win <<= l;
+		n++;
+	}
+
+	if (huff_check_pad(win, avail, huff, huff_end, bleft) < 0)
+		return -1;
+	return n;
+}
+
+/* Same as huff_dec() above, except that the upper bits of the stream are first
+ * looked up in the multi-symbol table, which delivers up to two symbols at once
+ * for the most common short codes. Only codes longer than RHT_MS_BITS bits are
+ * looked up in the cascaded tables. It returns the same values.
+ */
+int huff_dec_ms(const uint8_t *huff, int hlen, char *out, int olen)
+{
+	char *out_start = out;
+	char *out_end = out + olen;
+	const uint8_t *huff_end = huff + hlen;
+	const struct rht_ms *ms;
+	uint64_t win = 0;
+	uint32_t code = 0; /* The 30-bit code being looked up, MSB-aligned */
+	uint8_t sym = 0;
+	int avail = 0; /* valid bits in win */
+	int bleft; /* bits left */
+	int l;
+
+	bleft = hlen << 3;
+	while (bleft > 0 && out != out_end) {
+		huff_refill(&win, &avail, &huff, huff_end);
+
+		code = win >> 32;
+		ms = &rht_ms[code >> (32 - RHT_MS_BITS)];
+		if (likely(ms->l1) && bleft >= RHT_MS_BITS && out_end - out >= 2) {
+			/* both symbols are always stored, but the second one
+			 * is only counted if it exists.
 			 */
-			l = rht_bit15_11_fe[(code >> 11) & 0x1f].l;
-			sym = rht_bit15_11_fe[(code >> 11) & 0x1f].c;
-		}
-		else if (((code >> 8) & 0xff) < 0xf6) { /* 5..8 bits */
-			/* that's 0xff + 0xff */
-			l = rht_bit15_8[(code >> 8) & 0xff].l;
-			sym = rht_bit15_8[(code >> 8) & 0xff].c;
+			out[0] = ms->c[0];
+			out[1] = ms->c[1];
+			out += 1 + (ms->l != ms->l1);
+			l = ms->l;
 		}
 		else {
-			/* 0xff 0xff 0xf6..0xff */
-			l = rht_bit11_4[(code >> 4) & 0xff].l;
-			if (l < 30)
-				sym = rht_bit11_4[(code >> 4) & 0xff].c;
-			else if ((code & 0xff) == 0xf0)
-				sym = 10;
-			else if ((code & 0xff) == 0xf4)
-				sym = 13;
-			else if ((code & 0xff) == 0xf8)
-				sym = 22;
-			else { // 0xfc : EOS 
-				break;
+			if (ms->l1 && ms->l1 <= bleft) {
+				/* only the first symbol fits in the input or output */
+				l = ms->l1;
+				sym = ms->c[0];
 			}
+			else
+				l = huff_dec_sym(code, &sym);
+
+			if (!l || bleft - l < 0)
+				break;
+			*out++ = sym;
 		}
 
-		//fprintf(stderr, "out=%02d bleft=%03d code=%08x shift=%02d curr=%08x next=%08x sym=%02x l=%d\n", (int)(out-out_start), bleft, code, shift, curr, next, sym, l);
+		bleft -= l;
+		avail -= l;
+		win <<= l;
+	}
 
+	if (huff_check_pad(win, avail, huff, huff_end, bleft) < 0)
+		return -1;
 
+	if (out < out_end)
+		*out = 0; // end of string whenever possible
+	return out - out_start;
+}
+
+/* Same as huff_dec() above, except that the symbols are looked up using the
+ * canonical property of the code (see huff_dec_canon_sym()), which only needs
+ * less than 500 bytes of tables instead of 1.5 kB. It returns the same values.
+ */
+int huff_dec_canon(const uint8_t *huff, int hlen, char *out, int olen)
+{
+	char *out_start = out;
+	char *out_end = out + olen;
+	const uint8_t *huff_end = huff + hlen;
+	uint64_t win = 0;
+	uint32_t code = 0; /* The 30-bit code being looked up, MSB-aligned */
+	uint8_t sym = 0;
+	int avail = 0; /* valid bits in win */
+	int bleft; /* bits left */
+	int l;
+
+	bleft = hlen << 3;
+	while (bleft > 0 && out != out_end) {
+		huff_refill(&win, &avail, &huff, huff_end);
+
+		code = win >> 32;
+		l = huff_dec_canon_sym(code, &sym);
 		if (!l || bleft - l < 0)
 			break;
 
-		bleft -= l;
-		shift += l;
 		*out++ = sym;
+		bleft -= l;
+		avail -= l;
+		win <<= l;
 	}
 
-	if (bleft > 0) {
-		/* some bits were not consumed after the last code, they must
-		 * match EOS (ie: all ones).
-		 */
-		if ((code & -(1 << (32 - bleft))) != (uint32_t)-(1 << (32 - bleft))) {
-			fprintf(stderr, "bleft=%d curr=0x%08x\n", bleft, curr);
-			return -1;
+	if (huff_check_pad(win, avail, huff, huff_end, bleft) < 0)
+		return -1;
+
+	if (out < out_end)
+		*out = 0; // end of string whenever possible
+	return out - out_start;
+}
+
+/* Same as huff_dec() above, except that the stream is consumed 4 bits at a time
+ * through a finite state machine whose states are the internal nodes of the
+ * huffman tree. Each nibble emits at most one symbol since codes are at least
+ * 5 bits long. Input is read one byte at a time so there is no word to refill
+ * nor any tail to deal with, and as long as there is room for two symbols in
+ * the output, the loop doesn't contain any branch : the symbol is always
+ * written and only counted if emitted, and failures are only checked at the
+ * end. It returns -1 if EOS is found, if the padding is not a valid EOS prefix
+ * of less than 8 bits, or if the output is too short.
+ */
+int huff_dec_fsm(const uint8_t *huff, int hlen, char *out, int olen)
+{
+	char *out_start = out;
+	char *out_end = out + olen;
+	const uint8_t *huff_end = huff + hlen;
+	const struct rht_fsm *fsm;
+	uint8_t state = 0;
+	uint8_t flags = RHT_FSM_ACCEPT; /* an empty string is valid */
+	uint8_t all_flags = 0;
+	int nib;
+
+	while (huff < huff_end && out_end - out >= 2) {
+		fsm = &rht_fsm[state][*huff >> 4];
+		*out = fsm->sym;
+		out += fsm->flags & RHT_FSM_SYM;
+		all_flags |= fsm->flags;
+
+		fsm = &rht_fsm[fsm->state][*huff & 0x0f];
+		*out = fsm->sym;
+		out += fsm->flags & RHT_FSM_SYM;
+		all_flags |= fsm->flags;
+
+		state = fsm->state;
+		flags = fsm->flags;
+		huff++;
+	}
+
+	/* less than two output bytes left */
+	while (huff < huff_end) {
+		for (nib = 4; nib >= 0; nib -= 4) {
+			fsm = &rht_fsm[state][(*huff >> nib) & 0x0f];
+			if (fsm->flags & RHT_FSM_SYM) {
+				if (out == out_end)
+					return -1;
+				*out++ = fsm->sym;
+			}
+			all_flags |= fsm->flags;
+			state = fsm->state;
+			flags = fsm->flags;
 		}
+		huff++;
 	}
 
+	if ((all_flags & RHT_FSM_FAIL) || !(flags & RHT_FSM_ACCEPT))
+		return -1;
+
 	if (out < out_end)
 		*out = 0; // end of string whenever possible
 	return out - out_start;
 }
+
+/* all available decoders, the first one being the default one */
+const struct huff_dec_engine huff_dec_engines[] = {
+	{ "cascade", huff_dec       },
+	{ "multi",   huff_dec_ms    },
+	{ "canon",   huff_dec_canon },
+	{ "fsm",     huff_dec_fsm   },
+	{ NULL,      NULL           },
+};
+
+/* the decoder currently in use, see huff_dec_set_engine() */
+int (*huff_decode)(const uint8_t *huff, int hlen, char *out, int olen) = huff_dec;
+
+/* selects the decoder called by huff_decode() by its name. Returns 0 on
+ * success or -1 if no such engine exists.
+ */
+int huff_dec_set_engine(const char *name)
+{
+	const struct huff_dec_engine *engine;
+
+	for (engine = huff_dec_engines; engine->name; engine++) {
+		if (strcmp(engine->name, name) == 0) {
+			huff_decode = engine->dec;
+			return 0;
+		}
+	}
+	return -1;
+}
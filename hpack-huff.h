@@ -3,8 +3,43 @@
 
 #include <stdint.h>
 
+/* most continuation bytes of an integer, whose 35 bits hold any 32-bit value */
+#define VAR_INT_MAX_CONT 5
+
+/* a Huffman decoder, selectable at run time */
+struct huff_dec_engine {
+	const char *name;
+	int (*dec)(const uint8_t *huff, int hlen, char *out, int olen);
+};
+
+extern const struct huff_dec_engine huff_dec_engines[];
+extern int (*huff_decode)(const uint8_t *huff, int hlen, char *out, int olen);
+
+/* a Huffman length estimator, <supported> is NULL if always supported, and
+ * <min_len> is the shortest string it is picked for, or -1 if never.
+ */
+struct huff_len_engine {
+	const char *name;
+	uint32_t (*len)(const uint8_t *s, int len);
+	int (*supported)();
+	int min_len;
+};
+
+extern const struct huff_len_engine huff_len_engines[];
+uint32_t huff_len_bits(const uint8_t *s, int len);
+
+int huff_enc_len(const char *s, int len);
 int huff_enc(const char *s, char *out);
-int encode_string(const char *s);
+int huff_enc_max(const char *s, int len, char *out, int max);
+int put_var_int(uint8_t *out, uint8_t o, uint32_t v, int b);
+int put_var_int_wide(uint8_t *out, uint8_t o, uint32_t v, int b);
+uint32_t get_var_int(const uint8_t **raw_in, uint32_t *len_in, int b);
+int hpack_enc_str(const char *s, int len, uint8_t *out);
 int huff_dec(const uint8_t *huff, int hlen, char *out, int olen);
+int huff_dec_len(const uint8_t *huff, int hlen);
+int huff_dec_ms(const uint8_t *huff, int hlen, char *out, int olen);
+int huff_dec_canon(const uint8_t *huff, int hlen, char *out, int olen);
+int huff_dec_fsm(const uint8_t *huff, int hlen, char *out, int olen);
+int huff_dec_set_engine(const char *name);
 
 #endif
@@ -0,0 +1,138 @@
+/* Canonical huffman decoding tables, generated by "gen-rht -c".
+ * Do not edit, see gen-rht.c for their description.
+ */
+#define RHT_CANON_EOS 0xfffffffc /* codes at or above this are EOS */
+
+static const uint32_t rht_canon_limit[31] = {
+	[ 0] = 0x00000000,
+	[ 1] = 0x00000000,
+	[ 2] = 0x00000000,
+	[ 3] = 0x00000000,
+	[ 4] = 0x00000000,
+	[ 5] = 0x50000000,
+	[ 6] = 0xb8000000,
+	[ 7] = 0xf8000000,
+	[ 8] = 0xfe000000,
+	[ 9] = 0xfe000000,
+	[10] = 0xff400000,
+	[11] = 0xffa00000,
+	[12] = 0xffc00000,
+	[13] = 0xfff00000,
+	[14] = 0xfff80000,
+	[15] = 0xfffe0000,
+	[16] = 0xfffe0000,
+	[17] = 0xfffe0000,
+	[18] = 0xfffe0000,
+	[19] = 0xfffe6000,
+	[20] = 0xfffee000,
+	[21] = 0xffff4800,
+	[22] = 0xffffb000,
+	[23] = 0xffffea00,
+	[24] = 0xfffff600,
+	[25] = 0xfffff800,
+	[26] = 0xfffffbc0,
+	[27] = 0xfffffe20,
+	[28] = 0xfffffff0,
+	[29] = 0xfffffff0,
+	[30] = 0xfffffffc,
+};
+
+static const uint8_t rht_canon_ofs[31] = {
+	[ 5] =   0,
+	[ 6] =  10,
+	[ 7] =  36,
+	[ 8] =  68,
+	[ 9] =  74,
+	[10] =  74,
+	[11] =  79,
+	[12] =  82,
+	[13] =  84,
+	[14] =  90,
+	[15] =  92,
+	[16] =  95,
+	[17] =  95,
+	[18] =  95,
+	[19] =  95,
+	[20] =  98,
+	[21] = 106,
+	[22] = 119,
+	[23] = 145,
+	[24] = 174,
+	[25] = 186,
+	[26] = 190,
+	[27] = 205,
+	[28] = 224,
+	[29] = 253,
+	[30] = 253,
+};
+
+static const uint8_t rht_canon_start[32] = {
+	[ 0] =  5,
+	[ 1] =  6,
+	[ 2] =  7,
+	[ 3] =  7,
+	[ 4] =  7,
+	[ 5] =  8,
+	[ 6] =  8,
+	[ 7] = 10,
+	[ 8] = 10,
+	[ 9] = 11,
+	[10] = 13,
+	[11] = 13,
+	[12] = 14,
+	[13] = 15,
+	[14] = 15,
+	[15] = 19,
+	[16] = 21,
+	[17] = 22,
+	[18] = 23,
+	[19] = 23,
+	[20] = 24,
+	[21] = 26,
+	[22] = 27,
+	[23] = 27,
+	[24] = 28,
+	[25] = 28,
+	[26] = 28,
+	[27] = 28,
+	[28] = 30,
+	[29] = 30,
+};
+
+/* at most this number of extra lengths to walk after rht_canon_start[] */
+#define RHT_CANON_MAX_STEPS 2
+
+static const uint8_t rht_canon_sym[256] = {
+	0x30, 0x31, 0x32, 0x61, 0x63, 0x65, 0x69, 0x6f,
+	0x73, 0x74, 0x20, 0x25, 0x2d, 0x2e, 0x2f, 0x33,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3d, 0x41,
+	0x5f, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6c, 0x6d,
+	0x6e, 0x70, 0x72, 0x75, 0x3a, 0x42, 0x43, 0x44,
+	0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+	0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54,
+	0x55, 0x56, 0x57, 0x59, 0x6a, 0x6b, 0x71, 0x76,
+	0x77, 0x78, 0x79, 0x7a, 0x26, 0x2a, 0x2c, 0x3b,
+	0x58, 0x5a, 0x21, 0x22, 0x28, 0x29, 0x3f, 0x27,
+	0x2b, 0x7c, 0x23, 0x3e, 0x00, 0x24, 0x40, 0x5b,
+	0x5d, 0x7e, 0x5e, 0x7d, 0x3c, 0x60, 0x7b, 0x5c,
+	0xc3, 0xd0, 0x80, 0x82, 0x83, 0xa2, 0xb8, 0xc2,
+	0xe0, 0xe2, 0x99, 0xa1, 0xa7, 0xac, 0xb0, 0xb1,
+	0xb3, 0xd1, 0xd8, 0xd9, 0xe3, 0xe5, 0xe6, 0x81,
+	0x84, 0x85, 0x86, 0x88, 0x92, 0x9a, 0x9c, 0xa0,
+	0xa3, 0xa4, 0xa9, 0xaa, 0xad, 0xb2, 0xb5, 0xb9,
+	0xba, 0xbb, 0xbd, 0xbe, 0xc4, 0xc6, 0xe4, 0xe8,
+	0xe9, 0x01, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8d,
+	0x8f, 0x93, 0x95, 0x96, 0x97, 0x98, 0x9b, 0x9d,
+	0x9e, 0xa5, 0xa6, 0xa8, 0xae, 0xaf, 0xb4, 0xb6,
+	0xb7, 0xbc, 0xbf, 0xc5, 0xe7, 0xef, 0x09, 0x8e,
+	0x90, 0x91, 0x94, 0x9f, 0xab, 0xce, 0xd7, 0xe1,
+	0xec, 0xed, 0xc7, 0xcf, 0xea, 0xeb, 0xc0, 0xc1,
+	0xc8, 0xc9, 0xca, 0xcd, 0xd2, 0xd5, 0xda, 0xdb,
+	0xee, 0xf0, 0xf2, 0xf3, 0xff, 0xcb, 0xcc, 0xd3,
+	0xd4, 0xd6, 0xdd, 0xde, 0xdf, 0xf1, 0xf4, 0xf5,
+	0xf6, 0xf7, 0xf8, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe,
+	0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0b,
+	0x0c, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14,
+	0x15, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+	0x1e, 0x1f, 0x7f, 0xdc, 0xf9, 0x0a, 0x0d, 0x16,
+};
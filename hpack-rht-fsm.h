@@ -0,0 +1,1547 @@
+/* Nibble-driven huffman decoding FSM, generated by "gen-rht -f".
+ * Do not edit, it is indexed on the state (internal tree node, 0 being
+ * the root) then on the next input nibble, and gives { next state, flags,
+ * symbol }. See gen-rht.c for the flags.
+ */
+#define RHT_FSM_SYM    1
+#define RHT_FSM_FAIL   2
+#define RHT_FSM_ACCEPT 4
+
+static const struct rht_fsm rht_fsm[256][16] = {
+	[0x00] = {
+		{ 0x57, 0, 0x00 }, { 0x58, 0, 0x00 }, { 0x83, 0, 0x00 }, { 0x87, 0, 0x00 },
+		{ 0x8f, 0, 0x00 }, { 0x45, 0, 0x00 }, { 0x53, 0, 0x00 }, { 0x5a, 0, 0x00 },
+		{ 0x64, 0, 0x00 }, { 0x84, 0, 0x00 }, { 0x8a, 0, 0x00 }, { 0x5f, 0, 0x00 },
+		{ 0x69, 0, 0x00 }, { 0x70, 0, 0x00 }, { 0x77, 0, 0x00 }, { 0x04, 4, 0x00 },
+	},
+	[0x01] = {
+		{ 0x65, 0, 0x00 }, { 0x81, 0, 0x00 }, { 0x85, 0, 0x00 }, { 0x86, 0, 0x00 },
+		{ 0x8b, 0, 0x00 }, { 0x8c, 0, 0x00 }, { 0x8e, 0, 0x00 }, { 0x60, 0, 0x00 },
+		{ 0x6a, 0, 0x00 }, { 0x6d, 0, 0x00 }, { 0x71, 0, 0x00 }, { 0x74, 0, 0x00 },
+		{ 0x78, 0, 0x00 }, { 0x88, 0, 0x00 }, { 0x90, 0, 0x00 }, { 0x05, 4, 0x00 },
+	},
+	[0x02] = {
+		{ 0x6b, 0, 0x00 }, { 0x6c, 0, 0x00 }, { 0x6e, 0, 0x00 }, { 0x6f, 0, 0x00 },
+		{ 0x72, 0, 0x00 }, { 0x73, 0, 0x00 }, { 0x75, 0, 0x00 }, { 0x76, 0, 0x00 },
+		{ 0x79, 0, 0x00 }, { 0x7a, 0, 0x00 }, { 0x89, 0, 0x00 }, { 0x8d, 0, 0x00 },
+		{ 0x91, 0, 0x00 }, { 0x92, 0, 0x00 }, { 0x4b, 0, 0x00 }, { 0x06, 4, 0x00 },
+	},
+	[0x03] = {
+		{ 0x00, 5, 0x55 }, { 0x00, 5, 0x56 }, { 0x00, 5, 0x57 }, { 0x00, 5, 0x59 },
+		{ 0x00, 5, 0x6a }, { 0x00, 5, 0x6b }, { 0x00, 5, 0x71 }, { 0x00, 5, 0x76 },
+		{ 0x00, 5, 0x77 }, { 0x00, 5, 0x78 }, { 0x00, 5, 0x79 }, { 0x00, 5, 0x7a },
+		{ 0x4c, 0, 0x00 }, { 0x50, 0, 0x00 }, { 0x7b, 0, 0x00 }, { 0x07, 4, 0x00 },
+	},
+	[0x04] = {
+		{ 0x42, 1, 0x77 }, { 0x01, 5, 0x77 }, { 0x42, 1, 0x78 }, { 0x01, 5, 0x78 },
+		{ 0x42, 1, 0x79 }, { 0x01, 5, 0x79 }, { 0x42, 1, 0x7a }, { 0x01, 5, 0x7a },
+		{ 0x00, 5, 0x26 }, { 0x00, 5, 0x2a }, { 0x00, 5, 0x2c }, { 0x00, 5, 0x3b },
+		{ 0x00, 5, 0x58 }, { 0x00, 5, 0x5a }, { 0x47, 0, 0x00 }, { 0x08, 0, 0x00 },
+	},
+	[0x05] = {
+		{ 0x42, 1, 0x26 }, { 0x01, 5, 0x26 }, { 0x42, 1, 0x2a }, { 0x01, 5, 0x2a },
+		{ 0x42, 1, 0x2c }, { 0x01, 5, 0x2c }, { 0x42, 1, 0x3b }, { 0x01, 5, 0x3b },
+		{ 0x42, 1, 0x58 }, { 0x01, 5, 0x58 }, { 0x42, 1, 0x5a }, { 0x01, 5, 0x5a },
+		{ 0x48, 0, 0x00 }, { 0x4f, 0, 0x00 }, { 0x4d, 0, 0x00 }, { 0x09, 0, 0x00 },
+	},
+	[0x06] = {
+		{ 0x55, 1, 0x58 }, { 0x43, 1, 0x58 }, { 0x5d, 1, 0x58 }, { 0x02, 5, 0x58 },
+		{ 0x55, 1, 0x5a }, { 0x43, 1, 0x5a }, { 0x5d, 1, 0x5a }, { 0x02, 5, 0x5a },
+		{ 0x00, 5, 0x21 }, { 0x00, 5, 0x22 }, { 0x00, 5, 0x28 }, { 0x00, 5, 0x29 },
+		{ 0x00, 5, 0x3f }, { 0x4e, 0, 0x00 }, { 0x49, 0, 0x00 }, { 0x0a, 0, 0x00 },
+	},
+	[0x07] = {
+		{ 0x42, 1, 0x21 }, { 0x01, 5, 0x21 }, { 0x42, 1, 0x22 }, { 0x01, 5, 0x22 },
+		{ 0x42, 1, 0x28 }, { 0x01, 5, 0x28 }, { 0x42, 1, 0x29 }, { 0x01, 5, 0x29 },
+		{ 0x42, 1, 0x3f }, { 0x01, 5, 0x3f }, { 0x00, 5, 0x27 }, { 0x00, 5, 0x2b },
+		{ 0x00, 5, 0x7c }, { 0x4a, 0, 0x00 }, { 0x0b, 0, 0x00 }, { 0x0d, 0, 0x00 },
+	},
+	[0x08] = {
+		{ 0x55, 1, 0x3f }, { 0x43, 1, 0x3f }, { 0x5d, 1, 0x3f }, { 0x02, 5, 0x3f },
+		{ 0x42, 1, 0x27 }, { 0x01, 5, 0x27 }, { 0x42, 1, 0x2b }, { 0x01, 5, 0x2b },
+		{ 0x42, 1, 0x7c }, { 0x01, 5, 0x7c }, { 0x00, 5, 0x23 }, { 0x00, 5, 0x3e },
+		{ 0x0c, 0, 0x00 }, { 0x66, 0, 0x00 }, { 0x7f, 0, 0x00 }, { 0x0e, 0, 0x00 },
+	},
+	[0x09] = {
+		{ 0x55, 1, 0x7c }, { 0x43, 1, 0x7c }, { 0x5d, 1, 0x7c }, { 0x02, 5, 0x7c },
+		{ 0x42, 1, 0x23 }, { 0x01, 5, 0x23 }, { 0x42, 1, 0x3e }, { 0x01, 5, 0x3e },
+		{ 0x00, 5, 0x00 }, { 0x00, 5, 0x24 }, { 0x00, 5, 0x40 }, { 0x00, 5, 0x5b },
+		{ 0x00, 5, 0x5d }, { 0x00, 5, 0x7e }, { 0x80, 0, 0x00 }, { 0x0f, 0, 0x00 },
+	},
+	[0x0a] = {
+		{ 0x42, 1, 0x00 }, { 0x01, 5, 0x00 }, { 0x42, 1, 0x24 }, { 0x01, 5, 0x24 },
+		{ 0x42, 1, 0x40 }, { 0x01, 5, 0x40 }, { 0x42, 1, 0x5b }, { 0x01, 5, 0x5b },
+		{ 0x42, 1, 0x5d }, { 0x01, 5, 0x5d }, { 0x42, 1, 0x7e }, { 0x01, 5, 0x7e },
+		{ 0x00, 5, 0x5e }, { 0x00, 5, 0x7d }, { 0x62, 0, 0x00 }, { 0x10, 0, 0x00 },
+	},
+	[0x0b] = {
+		{ 0x55, 1, 0x00 }, { 0x43, 1, 0x00 }, { 0x5d, 1, 0x00 }, { 0x02, 5, 0x00 },
+		{ 0x55, 1, 0x24 }, { 0x43, 1, 0x24 }, { 0x5d, 1, 0x24 }, { 0x02, 5, 0x24 },
+		{ 0x55, 1, 0x40 }, { 0x43, 1, 0x40 }, { 0x5d, 1, 0x40 }, { 0x02, 5, 0x40 },
+		{ 0x55, 1, 0x5b }, { 0x43, 1, 0x5b }, { 0x5d, 1, 0x5b }, { 0x02, 5, 0x5b },
+	},
+	[0x0c] = {
+		{ 0x56, 1, 0x00 }, { 0x82, 1, 0x00 }, { 0x44, 1, 0x00 }, { 0x52, 1, 0x00 },
+		{ 0x63, 1, 0x00 }, { 0x5e, 1, 0x00 }, { 0x68, 1, 0x00 }, { 0x03, 5, 0x00 },
+		{ 0x56, 1, 0x24 }, { 0x82, 1, 0x24 }, { 0x44, 1, 0x24 }, { 0x52, 1, 0x24 },
+		{ 0x63, 1, 0x24 }, { 0x5e, 1, 0x24 }, { 0x68, 1, 0x24 }, { 0x03, 5, 0x24 },
+	},
+	[0x0d] = {
+		{ 0x55, 1, 0x5d }, { 0x43, 1, 0x5d }, { 0x5d, 1, 0x5d }, { 0x02, 5, 0x5d },
+		{ 0x55, 1, 0x7e }, { 0x43, 1, 0x7e }, { 0x5d, 1, 0x7e }, { 0x02, 5, 0x7e },
+		{ 0x42, 1, 0x5e }, { 0x01, 5, 0x5e }, { 0x42, 1, 0x7d }, { 0x01, 5, 0x7d },
+		{ 0x00, 5, 0x3c }, { 0x00, 5, 0x60 }, { 0x00, 5, 0x7b }, { 0x11, 0, 0x00 },
+	},
+	[0x0e] = {
+		{ 0x55, 1, 0x5e }, { 0x43, 1, 0x5e }, { 0x5d, 1, 0x5e }, { 0x02, 5, 0x5e },
+		{ 0x55, 1, 0x7d }, { 0x43, 1, 0x7d }, { 0x5d, 1, 0x7d }, { 0x02, 5, 0x7d },
+		{ 0x42, 1, 0x3c }, { 0x01, 5, 0x3c }, { 0x42, 1, 0x60 }, { 0x01, 5, 0x60 },
+		{ 0x42, 1, 0x7b }, { 0x01, 5, 0x7b }, { 0x7c, 0, 0x00 }, { 0x12, 0, 0x00 },
+	},
+	[0x0f] = {
+		{ 0x55, 1, 0x3c }, { 0x43, 1, 0x3c }, { 0x5d, 1, 0x3c }, { 0x02, 5, 0x3c },
+		{ 0x55, 1, 0x60 }, { 0x43, 1, 0x60 }, { 0x5d, 1, 0x60 }, { 0x02, 5, 0x60 },
+		{ 0x55, 1, 0x7b }, { 0x43, 1, 0x7b }, { 0x5d, 1, 0x7b }, { 0x02, 5, 0x7b },
+		{ 0x7d, 0, 0x00 }, { 0x9b, 0, 0x00 }, { 0x96, 0, 0x00 }, { 0x13, 0, 0x00 },
+	},
+	[0x10] = {
+		{ 0x56, 1, 0x7b }, { 0x82, 1, 0x7b }, { 0x44, 1, 0x7b }, { 0x52, 1, 0x7b },
+		{ 0x63, 1, 0x7b }, { 0x5e, 1, 0x7b }, { 0x68, 1, 0x7b }, { 0x03, 5, 0x7b },
+		{ 0x7e, 0, 0x00 }, { 0x94, 0, 0x00 }, { 0x9c, 0, 0x00 }, { 0xaf, 0, 0x00 },
+		{ 0xc4, 0, 0x00 }, { 0x97, 0, 0x00 }, { 0x14, 0, 0x00 }, { 0x19, 0, 0x00 },
+	},
+	[0x11] = {
+		{ 0x00, 5, 0x5c }, { 0x00, 5, 0xc3 }, { 0x00, 5, 0xd0 }, { 0x95, 0, 0x00 },
+		{ 0x9d, 0, 0x00 }, { 0xcc, 0, 0x00 }, { 0xf1, 0, 0x00 }, { 0xb0, 0, 0x00 },
+		{ 0xc5, 0, 0x00 }, { 0xeb, 0, 0x00 }, { 0x98, 0, 0x00 }, { 0xb2, 0, 0x00 },
+		{ 0xc7, 0, 0x00 }, { 0x15, 0, 0x00 }, { 0xa7, 0, 0x00 }, { 0x1a, 0, 0x00 },
+	},
+	[0x12] = {
+		{ 0xc6, 0, 0x00 }, { 0xca, 0, 0x00 }, { 0xec, 0, 0x00 }, { 0xf2, 0, 0x00 },
+		{ 0x99, 0, 0x00 }, { 0x9e, 0, 0x00 }, { 0xb3, 0, 0x00 }, { 0xb7, 0, 0x00 },
+		{ 0xc8, 0, 0x00 }, { 0xce, 0, 0x00 }, { 0xd8, 0, 0x00 }, { 0x16, 0, 0x00 },
+		{ 0xa8, 0, 0x00 }, { 0xb9, 0, 0x00 }, { 0x29, 0, 0x00 }, { 0x1b, 0, 0x00 },
+	},
+	[0x13] = {
+		{ 0xc9, 0, 0x00 }, { 0xcd, 0, 0x00 }, { 0xcf, 0, 0x00 }, { 0xd2, 0, 0x00 },
+		{ 0xd9, 0, 0x00 }, { 0xf3, 0, 0x00 }, { 0x17, 0, 0x00 }, { 0xa2, 0, 0x00 },
+		{ 0xa9, 0, 0x00 }, { 0xad, 0, 0x00 }, { 0xba, 0, 0x00 }, { 0xc2, 0, 0x00 },
+		{ 0xd0, 0, 0x00 }, { 0x2a, 0, 0x00 }, { 0xbf, 0, 0x00 }, { 0x1c, 0, 0x00 },
+	},
+	[0x14] = {
+		{ 0x00, 5, 0xb2 }, { 0x00, 5, 0xb5 }, { 0x00, 5, 0xb9 }, { 0x00, 5, 0xba },
+		{ 0x00, 5, 0xbb }, { 0x00, 5, 0xbd }, { 0x00, 5, 0xbe }, { 0x00, 5, 0xc4 },
+		{ 0x00, 5, 0xc6 }, { 0x00, 5, 0xe4 }, { 0x00, 5, 0xe8 }, { 0x00, 5, 0xe9 },
+		{ 0x18, 0, 0x00 }, { 0xa1, 0, 0x00 }, { 0xa3, 0, 0x00 }, { 0xa4, 0, 0x00 },
+	},
+	[0x15] = {
+		{ 0x42, 1, 0xc6 }, { 0x01, 5, 0xc6 }, { 0x42, 1, 0xe4 }, { 0x01, 5, 0xe4 },
+		{ 0x42, 1, 0xe8 }, { 0x01, 5, 0xe8 }, { 0x42, 1, 0xe9 }, { 0x01, 5, 0xe9 },
+		{ 0x00, 5, 0x01 }, { 0x00, 5, 0x87 }, { 0x00, 5, 0x89 }, { 0x00, 5, 0x8a },
+		{ 0x00, 5, 0x8b }, { 0x00, 5, 0x8c }, { 0x00, 5, 0x8d }, { 0x00, 5, 0x8f },
+	},
+	[0x16] = {
+		{ 0x42, 1, 0x01 }, { 0x01, 5, 0x01 }, { 0x42, 1, 0x87 }, { 0x01, 5, 0x87 },
+		{ 0x42, 1, 0x89 }, { 0x01, 5, 0x89 }, { 0x42, 1, 0x8a }, { 0x01, 5, 0x8a },
+		{ 0x42, 1, 0x8b }, { 0x01, 5, 0x8b }, { 0x42, 1, 0x8c }, { 0x01, 5, 0x8c },
+		{ 0x42, 1, 0x8d }, { 0x01, 5, 0x8d }, { 0x42, 1, 0x8f }, { 0x01, 5, 0x8f },
+	},
+	[0x17] = {
+		{ 0x55, 1, 0x01 }, { 0x43, 1, 0x01 }, { 0x5d, 1, 0x01 }, { 0x02, 5, 0x01 },
+		{ 0x55, 1, 0x87 }, { 0x43, 1, 0x87 }, { 0x5d, 1, 0x87 }, { 0x02, 5, 0x87 },
+		{ 0x55, 1, 0x89 }, { 0x43, 1, 0x89 }, { 0x5d, 1, 0x89 }, { 0x02, 5, 0x89 },
+		{ 0x55, 1, 0x8a }, { 0x43, 1, 0x8a }, { 0x5d, 1, 0x8a }, { 0x02, 5, 0x8a },
+	},
+	[0x18] = {
+		{ 0x56, 1, 0x01 }, { 0x82, 1, 0x01 }, { 0x44, 1, 0x01 }, { 0x52, 1, 0x01 },
+		{ 0x63, 1, 0x01 }, { 0x5e, 1, 0x01 }, { 0x68, 1, 0x01 }, { 0x03, 5, 0x01 },
+		{ 0x56, 1, 0x87 }, { 0x82, 1, 0x87 }, { 0x44, 1, 0x87 }, { 0x52, 1, 0x87 },
+		{ 0x63, 1, 0x87 }, { 0x5e, 1, 0x87 }, { 0x68, 1, 0x87 }, { 0x03, 5, 0x87 },
+	},
+	[0x19] = {
+		{ 0xaa, 0, 0x00 }, { 0xac, 0, 0x00 }, { 0xae, 0, 0x00 }, { 0xb5, 0, 0x00 },
+		{ 0xbb, 0, 0x00 }, { 0xbd, 0, 0x00 }, { 0xc3, 0, 0x00 }, { 0xcb, 0, 0x00 },
+		{ 0xd1, 0, 0x00 }, { 0xd7, 0, 0x00 }, { 0x2b, 0, 0x00 }, { 0xa5, 0, 0x00 },
+		{ 0xc0, 0, 0x00 }, { 0xda, 0, 0x00 }, { 0xd3, 0, 0x00 }, { 0x1d, 0, 0x00 },
+	},
+	[0x1a] = {
+		{ 0x00, 5, 0xbc }, { 0x00, 5, 0xbf }, { 0x00, 5, 0xc5 }, { 0x00, 5, 0xe7 },
+		{ 0x00, 5, 0xef }, { 0x2c, 0, 0x00 }, { 0xa6, 0, 0x00 }, { 0xab, 0, 0x00 },
+		{ 0xc1, 0, 0x00 }, { 0xea, 0, 0x00 }, { 0xf5, 0, 0x00 }, { 0xdb, 0, 0x00 },
+		{ 0xd4, 0, 0x00 }, { 0xe0, 0, 0x00 }, { 0xe5, 0, 0x00 }, { 0x1e, 0, 0x00 },
+	},
+	[0x1b] = {
+		{ 0x00, 5, 0xab }, { 0x00, 5, 0xce }, { 0x00, 5, 0xd7 }, { 0x00, 5, 0xe1 },
+		{ 0x00, 5, 0xec }, { 0x00, 5, 0xed }, { 0xdc, 0, 0x00 }, { 0xf4, 0, 0x00 },
+		{ 0xd5, 0, 0x00 }, { 0xde, 0, 0x00 }, { 0xed, 0, 0x00 }, { 0xe1, 0, 0x00 },
+		{ 0xe6, 0, 0x00 }, { 0xf9, 0, 0x00 }, { 0x1f, 0, 0x00 }, { 0x2d, 0, 0x00 },
+	},
+	[0x1c] = {
+		{ 0xd6, 0, 0x00 }, { 0xdd, 0, 0x00 }, { 0xdf, 0, 0x00 }, { 0xe4, 0, 0x00 },
+		{ 0xee, 0, 0x00 }, { 0xf6, 0, 0x00 }, { 0xf8, 0, 0x00 }, { 0xe2, 0, 0x00 },
+		{ 0xe7, 0, 0x00 }, { 0xef, 0, 0x00 }, { 0xfa, 0, 0x00 }, { 0xfd, 0, 0x00 },
+		{ 0x20, 0, 0x00 }, { 0x26, 0, 0x00 }, { 0x37, 0, 0x00 }, { 0x2e, 0, 0x00 },
+	},
+	[0x1d] = {
+		{ 0xe8, 0, 0x00 }, { 0xe9, 0, 0x00 }, { 0xf0, 0, 0x00 }, { 0xf7, 0, 0x00 },
+		{ 0xfb, 0, 0x00 }, { 0xfc, 0, 0x00 }, { 0xfe, 0, 0x00 }, { 0xff, 0, 0x00 },
+		{ 0x21, 0, 0x00 }, { 0x23, 0, 0x00 }, { 0x27, 0, 0x00 }, { 0x34, 0, 0x00 },
+		{ 0x38, 0, 0x00 }, { 0x3c, 0, 0x00 }, { 0x3f, 0, 0x00 }, { 0x2f, 0, 0x00 },
+	},
+	[0x1e] = {
+		{ 0x00, 5, 0xfe }, { 0x22, 0, 0x00 }, { 0x24, 0, 0x00 }, { 0x25, 0, 0x00 },
+		{ 0x28, 0, 0x00 }, { 0x33, 0, 0x00 }, { 0x35, 0, 0x00 }, { 0x36, 0, 0x00 },
+		{ 0x39, 0, 0x00 }, { 0x3a, 0, 0x00 }, { 0x3d, 0, 0x00 }, { 0x3e, 0, 0x00 },
+		{ 0x40, 0, 0x00 }, { 0x41, 0, 0x00 }, { 0x93, 0, 0x00 }, { 0x30, 0, 0x00 },
+	},
+	[0x1f] = {
+		{ 0x42, 1, 0xfe }, { 0x01, 5, 0xfe }, { 0x00, 5, 0x02 }, { 0x00, 5, 0x03 },
+		{ 0x00, 5, 0x04 }, { 0x00, 5, 0x05 }, { 0x00, 5, 0x06 }, { 0x00, 5, 0x07 },
+		{ 0x00, 5, 0x08 }, { 0x00, 5, 0x0b }, { 0x00, 5, 0x0c }, { 0x00, 5, 0x0e },
+		{ 0x00, 5, 0x0f }, { 0x00, 5, 0x10 }, { 0x00, 5, 0x11 }, { 0x00, 5, 0x12 },
+	},
+	[0x20] = {
+		{ 0x55, 1, 0xfe }, { 0x43, 1, 0xfe }, { 0x5d, 1, 0xfe }, { 0x02, 5, 0xfe },
+		{ 0x42, 1, 0x02 }, { 0x01, 5, 0x02 }, { 0x42, 1, 0x03 }, { 0x01, 5, 0x03 },
+		{ 0x42, 1, 0x04 }, { 0x01, 5, 0x04 }, { 0x42, 1, 0x05 }, { 0x01, 5, 0x05 },
+		{ 0x42, 1, 0x06 }, { 0x01, 5, 0x06 }, { 0x42, 1, 0x07 }, { 0x01, 5, 0x07 },
+	},
+	[0x21] = {
+		{ 0x56, 1, 0xfe }, { 0x82, 1, 0xfe }, { 0x44, 1, 0xfe }, { 0x52, 1, 0xfe },
+		{ 0x63, 1, 0xfe }, { 0x5e, 1, 0xfe }, { 0x68, 1, 0xfe }, { 0x03, 5, 0xfe },
+		{ 0x55, 1, 0x02 }, { 0x43, 1, 0x02 }, { 0x5d, 1, 0x02 }, { 0x02, 5, 0x02 },
+		{ 0x55, 1, 0x03 }, { 0x43, 1, 0x03 }, { 0x5d, 1, 0x03 }, { 0x02, 5, 0x03 },
+	},
+	[0x22] = {
+		{ 0x56, 1, 0x02 }, { 0x82, 1, 0x02 }, { 0x44, 1, 0x02 }, { 0x52, 1, 0x02 },
+		{ 0x63, 1, 0x02 }, { 0x5e, 1, 0x02 }, { 0x68, 1, 0x02 }, { 0x03, 5, 0x02 },
+		{ 0x56, 1, 0x03 }, { 0x82, 1, 0x03 }, { 0x44, 1, 0x03 }, { 0x52, 1, 0x03 },
+		{ 0x63, 1, 0x03 }, { 0x5e, 1, 0x03 }, { 0x68, 1, 0x03 }, { 0x03, 5, 0x03 },
+	},
+	[0x23] = {
+		{ 0x55, 1, 0x04 }, { 0x43, 1, 0x04 }, { 0x5d, 1, 0x04 }, { 0x02, 5, 0x04 },
+		{ 0x55, 1, 0x05 }, { 0x43, 1, 0x05 }, { 0x5d, 1, 0x05 }, { 0x02, 5, 0x05 },
+		{ 0x55, 1, 0x06 }, { 0x43, 1, 0x06 }, { 0x5d, 1, 0x06 }, { 0x02, 5, 0x06 },
+		{ 0x55, 1, 0x07 }, { 0x43, 1, 0x07 }, { 0x5d, 1, 0x07 }, { 0x02, 5, 0x07 },
+	},
+	[0x24] = {
+		{ 0x56, 1, 0x04 }, { 0x82, 1, 0x04 }, { 0x44, 1, 0x04 }, { 0x52, 1, 0x04 },
+		{ 0x63, 1, 0x04 }, { 0x5e, 1, 0x04 }, { 0x68, 1, 0x04 }, { 0x03, 5, 0x04 },
+		{ 0x56, 1, 0x05 }, { 0x82, 1, 0x05 }, { 0x44, 1, 0x05 }, { 0x52, 1, 0x05 },
+		{ 0x63, 1, 0x05 }, { 0x5e, 1, 0x05 }, { 0x68, 1, 0x05 }, { 0x03, 5, 0x05 },
+	},
+	[0x25] = {
+		{ 0x56, 1, 0x06 }, { 0x82, 1, 0x06 }, { 0x44, 1, 0x06 }, { 0x52, 1, 0x06 },
+		{ 0x63, 1, 0x06 }, { 0x5e, 1, 0x06 }, { 0x68, 1, 0x06 }, { 0x03, 5, 0x06 },
+		{ 0x56, 1, 0x07 }, { 0x82, 1, 0x07 }, { 0x44, 1, 0x07 }, { 0x52, 1, 0x07 },
+		{ 0x63, 1, 0x07 }, { 0x5e, 1, 0x07 }, { 0x68, 1, 0x07 }, { 0x03, 5, 0x07 },
+	},
+	[0x26] = {
+		{ 0x42, 1, 0x08 }, { 0x01, 5, 0x08 }, { 0x42, 1, 0x0b }, { 0x01, 5, 0x0b },
+		{ 0x42, 1, 0x0c }, { 0x01, 5, 0x0c }, { 0x42, 1, 0x0e }, { 0x01, 5, 0x0e },
+		{ 0x42, 1, 0x0f }, { 0x01, 5, 0x0f }, { 0x42, 1, 0x10 }, { 0x01, 5, 0x10 },
+		{ 0x42, 1, 0x11 }, { 0x01, 5, 0x11 }, { 0x42, 1, 0x12 }, { 0x01, 5, 0x12 },
+	},
+	[0x27] = {
+		{ 0x55, 1, 0x08 }, { 0x43, 1, 0x08 }, { 0x5d, 1, 0x08 }, { 0x02, 5, 0x08 },
+		{ 0x55, 1, 0x0b }, { 0x43, 1, 0x0b }, { 0x5d, 1, 0x0b }, { 0x02, 5, 0x0b },
+		{ 0x55, 1, 0x0c }, { 0x43, 1, 0x0c }, { 0x5d, 1, 0x0c }, { 0x02, 5, 0x0c },
+		{ 0x55, 1, 0x0e }, { 0x43, 1, 0x0e }, { 0x5d, 1, 0x0e }, { 0x02, 5, 0x0e },
+	},
+	[0x28] = {
+		{ 0x56, 1, 0x08 }, { 0x82, 1, 0x08 }, { 0x44, 1, 0x08 }, { 0x52, 1, 0x08 },
+		{ 0x63, 1, 0x08 }, { 0x5e, 1, 0x08 }, { 0x68, 1, 0x08 }, { 0x03, 5, 0x08 },
+		{ 0x56, 1, 0x0b }, { 0x82, 1, 0x0b }, { 0x44, 1, 0x0b }, { 0x52, 1, 0x0b },
+		{ 0x63, 1, 0x0b }, { 0x5e, 1, 0x0b }, { 0x68, 1, 0x0b }, { 0x03, 5, 0x0b },
+	},
+	[0x29] = {
+		{ 0x42, 1, 0xbc }, { 0x01, 5, 0xbc }, { 0x42, 1, 0xbf }, { 0x01, 5, 0xbf },
+		{ 0x42, 1, 0xc5 }, { 0x01, 5, 0xc5 }, { 0x42, 1, 0xe7 }, { 0x01, 5, 0xe7 },
+		{ 0x42, 1, 0xef }, { 0x01, 5, 0xef }, { 0x00, 5, 0x09 }, { 0x00, 5, 0x8e },
+		{ 0x00, 5, 0x90 }, { 0x00, 5, 0x91 }, { 0x00, 5, 0x94 }, { 0x00, 5, 0x9f },
+	},
+	[0x2a] = {
+		{ 0x55, 1, 0xef }, { 0x43, 1, 0xef }, { 0x5d, 1, 0xef }, { 0x02, 5, 0xef },
+		{ 0x42, 1, 0x09 }, { 0x01, 5, 0x09 }, { 0x42, 1, 0x8e }, { 0x01, 5, 0x8e },
+		{ 0x42, 1, 0x90 }, { 0x01, 5, 0x90 }, { 0x42, 1, 0x91 }, { 0x01, 5, 0x91 },
+		{ 0x42, 1, 0x94 }, { 0x01, 5, 0x94 }, { 0x42, 1, 0x9f }, { 0x01, 5, 0x9f },
+	},
+	[0x2b] = {
+		{ 0x56, 1, 0xef }, { 0x82, 1, 0xef }, { 0x44, 1, 0xef }, { 0x52, 1, 0xef },
+		{ 0x63, 1, 0xef }, { 0x5e, 1, 0xef }, { 0x68, 1, 0xef }, { 0x03, 5, 0xef },
+		{ 0x55, 1, 0x09 }, { 0x43, 1, 0x09 }, { 0x5d, 1, 0x09 }, { 0x02, 5, 0x09 },
+		{ 0x55, 1, 0x8e }, { 0x43, 1, 0x8e }, { 0x5d, 1, 0x8e }, { 0x02, 5, 0x8e },
+	},
+	[0x2c] = {
+		{ 0x56, 1, 0x09 }, { 0x82, 1, 0x09 }, { 0x44, 1, 0x09 }, { 0x52, 1, 0x09 },
+		{ 0x63, 1, 0x09 }, { 0x5e, 1, 0x09 }, { 0x68, 1, 0x09 }, { 0x03, 5, 0x09 },
+		{ 0x56, 1, 0x8e }, { 0x82, 1, 0x8e }, { 0x44, 1, 0x8e }, { 0x52, 1, 0x8e },
+		{ 0x63, 1, 0x8e }, { 0x5e, 1, 0x8e }, { 0x68, 1, 0x8e }, { 0x03, 5, 0x8e },
+	},
+	[0x2d] = {
+		{ 0x00, 5, 0x13 }, { 0x00, 5, 0x14 }, { 0x00, 5, 0x15 }, { 0x00, 5, 0x17 },
+		{ 0x00, 5, 0x18 }, { 0x00, 5, 0x19 }, { 0x00, 5, 0x1a }, { 0x00, 5, 0x1b },
+		{ 0x00, 5, 0x1c }, { 0x00, 5, 0x1d }, { 0x00, 5, 0x1e }, { 0x00, 5, 0x1f },
+		{ 0x00, 5, 0x7f }, { 0x00, 5, 0xdc }, { 0x00, 5, 0xf9 }, { 0x31, 0, 0x00 },
+	},
+	[0x2e] = {
+		{ 0x42, 1, 0x1c }, { 0x01, 5, 0x1c }, { 0x42, 1, 0x1d }, { 0x01, 5, 0x1d },
+		{ 0x42, 1, 0x1e }, { 0x01, 5, 0x1e }, { 0x42, 1, 0x1f }, { 0x01, 5, 0x1f },
+		{ 0x42, 1, 0x7f }, { 0x01, 5, 0x7f }, { 0x42, 1, 0xdc }, { 0x01, 5, 0xdc },
+		{ 0x42, 1, 0xf9 }, { 0x01, 5, 0xf9 }, { 0x32, 0, 0x00 }, { 0x3b, 0, 0x00 },
+	},
+	[0x2f] = {
+		{ 0x55, 1, 0x7f }, { 0x43, 1, 0x7f }, { 0x5d, 1, 0x7f }, { 0x02, 5, 0x7f },
+		{ 0x55, 1, 0xdc }, { 0x43, 1, 0xdc }, { 0x5d, 1, 0xdc }, { 0x02, 5, 0xdc },
+		{ 0x55, 1, 0xf9 }, { 0x43, 1, 0xf9 }, { 0x5d, 1, 0xf9 }, { 0x02, 5, 0xf9 },
+		{ 0x00, 5, 0x0a }, { 0x00, 5, 0x0d }, { 0x00, 5, 0x16 }, { 0x00, 2, 0x00 },
+	},
+	[0x30] = {
+		{ 0x56, 1, 0xf9 }, { 0x82, 1, 0xf9 }, { 0x44, 1, 0xf9 }, { 0x52, 1, 0xf9 },
+		{ 0x63, 1, 0xf9 }, { 0x5e, 1, 0xf9 }, { 0x68, 1, 0xf9 }, { 0x03, 5, 0xf9 },
+		{ 0x42, 1, 0x0a }, { 0x01, 5, 0x0a }, { 0x42, 1, 0x0d }, { 0x01, 5, 0x0d },
+		{ 0x42, 1, 0x16 }, { 0x01, 5, 0x16 }, { 0x00, 2, 0x00 }, { 0x00, 2, 0x00 },
+	},
+	[0x31] = {
+		{ 0x55, 1, 0x0a }, { 0x43, 1, 0x0a }, { 0x5d, 1, 0x0a }, { 0x02, 5, 0x0a },
+		{ 0x55, 1, 0x0d }, { 0x43, 1, 0x0d }, { 0x5d, 1, 0x0d }, { 0x02, 5, 0x0d },
+		{ 0x55, 1, 0x16 }, { 0x43, 1, 0x16 }, { 0x5d, 1, 0x16 }, { 0x02, 5, 0x16 },
+		{ 0x00, 2, 0x00 }, { 0x00, 2, 0x00 }, { 0x00, 2, 0x00 }, { 0x00, 2, 0x00 },
+	},
+	[0x32] = {
+		{ 0x56, 1, 0x0a }, { 0x82, 1, 0x0a }, { 0x44, 1, 0x0a }, { 0x52, 1, 0x0a },
+		{ 0x63, 1, 0x0a }, { 0x5e, 1, 0x0a }, { 0x68, 1, 0x0a }, { 0x03, 5, 0x0a },
+		{ 0x56, 1, 0x0d }, { 0x82, 1, 0x0d }, { 0x44, 1, 0x0d }, { 0x52, 1, 0x0d },
+		{ 0x63, 1, 0x0d }, { 0x5e, 1, 0x0d }, { 0x68, 1, 0x0d }, { 0x03, 5, 0x0d },
+	},
+	[0x33] = {
+		{ 0x56, 1, 0x0c }, { 0x82, 1, 0x0c }, { 0x44, 1, 0x0c }, { 0x52, 1, 0x0c },
+		{ 0x63, 1, 0x0c }, { 0x5e, 1, 0x0c }, { 0x68, 1, 0x0c }, { 0x03, 5, 0x0c },
+		{ 0x56, 1, 0x0e }, { 0x82, 1, 0x0e }, { 0x44, 1, 0x0e }, { 0x52, 1, 0x0e },
+		{ 0x63, 1, 0x0e }, { 0x5e, 1, 0x0e }, { 0x68, 1, 0x0e }, { 0x03, 5, 0x0e },
+	},
+	[0x34] = {
+		{ 0x55, 1, 0x0f }, { 0x43, 1, 0x0f }, { 0x5d, 1, 0x0f }, { 0x02, 5, 0x0f },
+		{ 0x55, 1, 0x10 }, { 0x43, 1, 0x10 }, { 0x5d, 1, 0x10 }, { 0x02, 5, 0x10 },
+		{ 0x55, 1, 0x11 }, { 0x43, 1, 0x11 }, { 0x5d, 1, 0x11 }, { 0x02, 5, 0x11 },
+		{ 0x55, 1, 0x12 }, { 0x43, 1, 0x12 }, { 0x5d, 1, 0x12 }, { 0x02, 5, 0x12 },
+	},
+	[0x35] = {
+		{ 0x56, 1, 0x0f }, { 0x82, 1, 0x0f }, { 0x44, 1, 0x0f }, { 0x52, 1, 0x0f },
+		{ 0x63, 1, 0x0f }, { 0x5e, 1, 0x0f }, { 0x68, 1, 0x0f }, { 0x03, 5, 0x0f },
+		{ 0x56, 1, 0x10 }, { 0x82, 1, 0x10 }, { 0x44, 1, 0x10 }, { 0x52, 1, 0x10 },
+		{ 0x63, 1, 0x10 }, { 0x5e, 1, 0x10 }, { 0x68, 1, 0x10 }, { 0x03, 5, 0x10 },
+	},
+	[0x36] = {
+		{ 0x56, 1, 0x11 }, { 0x82, 1, 0x11 }, { 0x44, 1, 0x11 }, { 0x52, 1, 0x11 },
+		{ 0x63, 1, 0x11 }, { 0x5e, 1, 0x11 }, { 0x68, 1, 0x11 }, { 0x03, 5, 0x11 },
+		{ 0x56, 1, 0x12 }, { 0x82, 1, 0x12 }, { 0x44, 1, 0x12 }, { 0x52, 1, 0x12 },
+		{ 0x63, 1, 0x12 }, { 0x5e, 1, 0x12 }, { 0x68, 1, 0x12 }, { 0x03, 5, 0x12 },
+	},
+	[0x37] = {
+		{ 0x42, 1, 0x13 }, { 0x01, 5, 0x13 }, { 0x42, 1, 0x14 }, { 0x01, 5, 0x14 },
+		{ 0x42, 1, 0x15 }, { 0x01, 5, 0x15 }, { 0x42, 1, 0x17 }, { 0x01, 5, 0x17 },
+		{ 0x42, 1, 0x18 }, { 0x01, 5, 0x18 }, { 0x42, 1, 0x19 }, { 0x01, 5, 0x19 },
+		{ 0x42, 1, 0x1a }, { 0x01, 5, 0x1a }, { 0x42, 1, 0x1b }, { 0x01, 5, 0x1b },
+	},
+	[0x38] = {
+		{ 0x55, 1, 0x13 }, { 0x43, 1, 0x13 }, { 0x5d, 1, 0x13 }, { 0x02, 5, 0x13 },
+		{ 0x55, 1, 0x14 }, { 0x43, 1, 0x14 }, { 0x5d, 1, 0x14 }, { 0x02, 5, 0x14 },
+		{ 0x55, 1, 0x15 }, { 0x43, 1, 0x15 }, { 0x5d, 1, 0x15 }, { 0x02, 5, 0x15 },
+		{ 0x55, 1, 0x17 }, { 0x43, 1, 0x17 }, { 0x5d, 1, 0x17 }, { 0x02, 5, 0x17 },
+	},
+	[0x39] = {
+		{ 0x56, 1, 0x13 }, { 0x82, 1, 0x13 }, { 0x44, 1, 0x13 }, { 0x52, 1, 0x13 },
+		{ 0x63, 1, 0x13 }, { 0x5e, 1, 0x13 }, { 0x68, 1, 0x13 }, { 0x03, 5, 0x13 },
+		{ 0x56, 1, 0x14 }, { 0x82, 1, 0x14 }, { 0x44, 1, 0x14 }, { 0x52, 1, 0x14 },
+		{ 0x63, 1, 0x14 }, { 0x5e, 1, 0x14 }, { 0x68, 1, 0x14 }, { 0x03, 5, 0x14 },
+	},
+	[0x3a] = {
+		{ 0x56, 1, 0x15 }, { 0x82, 1, 0x15 }, { 0x44, 1, 0x15 }, { 0x52, 1, 0x15 },
+		{ 0x63, 1, 0x15 }, { 0x5e, 1, 0x15 }, { 0x68, 1, 0x15 }, { 0x03, 5, 0x15 },
+		{ 0x56, 1, 0x17 }, { 0x82, 1, 0x17 }, { 0x44, 1, 0x17 }, { 0x52, 1, 0x17 },
+		{ 0x63, 1, 0x17 }, { 0x5e, 1, 0x17 }, { 0x68, 1, 0x17 }, { 0x03, 5, 0x17 },
+	},
+	[0x3b] = {
+		{ 0x56, 1, 0x16 }, { 0x82, 1, 0x16 }, { 0x44, 1, 0x16 }, { 0x52, 1, 0x16 },
+		{ 0x63, 1, 0x16 }, { 0x5e, 1, 0x16 }, { 0x68, 1, 0x16 }, { 0x03, 5, 0x16 },
+		{ 0x00, 2, 0x00 }, { 0x00, 2, 0x00 }, { 0x00, 2, 0x00 }, { 0x00, 2, 0x00 },
+		{ 0x00, 2, 0x00 }, { 0x00, 2, 0x00 }, { 0x00, 2, 0x00 }, { 0x00, 2, 0x00 },
+	},
+	[0x3c] = {
+		{ 0x55, 1, 0x18 }, { 0x43, 1, 0x18 }, { 0x5d, 1, 0x18 }, { 0x02, 5, 0x18 },
+		{ 0x55, 1, 0x19 }, { 0x43, 1, 0x19 }, { 0x5d, 1, 0x19 }, { 0x02, 5, 0x19 },
+		{ 0x55, 1, 0x1a }, { 0x43, 1, 0x1a }, { 0x5d, 1, 0x1a }, { 0x02, 5, 0x1a },
+		{ 0x55, 1, 0x1b }, { 0x43, 1, 0x1b }, { 0x5d, 1, 0x1b }, { 0x02, 5, 0x1b },
+	},
+	[0x3d] = {
+		{ 0x56, 1, 0x18 }, { 0x82, 1, 0x18 }, { 0x44, 1, 0x18 }, { 0x52, 1, 0x18 },
+		{ 0x63, 1, 0x18 }, { 0x5e, 1, 0x18 }, { 0x68, 1, 0x18 }, { 0x03, 5, 0x18 },
+		{ 0x56, 1, 0x19 }, { 0x82, 1, 0x19 }, { 0x44, 1, 0x19 }, { 0x52, 1, 0x19 },
+		{ 0x63, 1, 0x19 }, { 0x5e, 1, 0x19 }, { 0x68, 1, 0x19 }, { 0x03, 5, 0x19 },
+	},
+	[0x3e] = {
+		{ 0x56, 1, 0x1a }, { 0x82, 1, 0x1a }, { 0x44, 1, 0x1a }, { 0x52, 1, 0x1a },
+		{ 0x63, 1, 0x1a }, { 0x5e, 1, 0x1a }, { 0x68, 1, 0x1a }, { 0x03, 5, 0x1a },
+		{ 0x56, 1, 0x1b }, { 0x82, 1, 0x1b }, { 0x44, 1, 0x1b }, { 0x52, 1, 0x1b },
+		{ 0x63, 1, 0x1b }, { 0x5e, 1, 0x1b }, { 0x68, 1, 0x1b }, { 0x03, 5, 0x1b },
+	},
+	[0x3f] = {
+		{ 0x55, 1, 0x1c }, { 0x43, 1, 0x1c }, { 0x5d, 1, 0x1c }, { 0x02, 5, 0x1c },
+		{ 0x55, 1, 0x1d }, { 0x43, 1, 0x1d }, { 0x5d, 1, 0x1d }, { 0x02, 5, 0x1d },
+		{ 0x55, 1, 0x1e }, { 0x43, 1, 0x1e }, { 0x5d, 1, 0x1e }, { 0x02, 5, 0x1e },
+		{ 0x55, 1, 0x1f }, { 0x43, 1, 0x1f }, { 0x5d, 1, 0x1f }, { 0x02, 5, 0x1f },
+	},
+	[0x40] = {
+		{ 0x56, 1, 0x1c }, { 0x82, 1, 0x1c }, { 0x44, 1, 0x1c }, { 0x52, 1, 0x1c },
+		{ 0x63, 1, 0x1c }, { 0x5e, 1, 0x1c }, { 0x68, 1, 0x1c }, { 0x03, 5, 0x1c },
+		{ 0x56, 1, 0x1d }, { 0x82, 1, 0x1d }, { 0x44, 1, 0x1d }, { 0x52, 1, 0x1d },
+		{ 0x63, 1, 0x1d }, { 0x5e, 1, 0x1d }, { 0x68, 1, 0x1d }, { 0x03, 5, 0x1d },
+	},
+	[0x41] = {
+		{ 0x56, 1, 0x1e }, { 0x82, 1, 0x1e }, { 0x44, 1, 0x1e }, { 0x52, 1, 0x1e },
+		{ 0x63, 1, 0x1e }, { 0x5e, 1, 0x1e }, { 0x68, 1, 0x1e }, { 0x03, 5, 0x1e },
+		{ 0x56, 1, 0x1f }, { 0x82, 1, 0x1f }, { 0x44, 1, 0x1f }, { 0x52, 1, 0x1f },
+		{ 0x63, 1, 0x1f }, { 0x5e, 1, 0x1f }, { 0x68, 1, 0x1f }, { 0x03, 5, 0x1f },
+	},
+	[0x42] = {
+		{ 0x00, 5, 0x30 }, { 0x00, 5, 0x31 }, { 0x00, 5, 0x32 }, { 0x00, 5, 0x61 },
+		{ 0x00, 5, 0x63 }, { 0x00, 5, 0x65 }, { 0x00, 5, 0x69 }, { 0x00, 5, 0x6f },
+		{ 0x00, 5, 0x73 }, { 0x00, 5, 0x74 }, { 0x46, 0, 0x00 }, { 0x51, 0, 0x00 },
+		{ 0x54, 0, 0x00 }, { 0x59, 0, 0x00 }, { 0x5b, 0, 0x00 }, { 0x5c, 0, 0x00 },
+	},
+	[0x43] = {
+		{ 0x42, 1, 0x73 }, { 0x01, 5, 0x73 }, { 0x42, 1, 0x74 }, { 0x01, 5, 0x74 },
+		{ 0x00, 5, 0x20 }, { 0x00, 5, 0x25 }, { 0x00, 5, 0x2d }, { 0x00, 5, 0x2e },
+		{ 0x00, 5, 0x2f }, { 0x00, 5, 0x33 }, { 0x00, 5, 0x34 }, { 0x00, 5, 0x35 },
+		{ 0x00, 5, 0x36 }, { 0x00, 5, 0x37 }, { 0x00, 5, 0x38 }, { 0x00, 5, 0x39 },
+	},
+	[0x44] = {
+		{ 0x55, 1, 0x73 }, { 0x43, 1, 0x73 }, { 0x5d, 1, 0x73 }, { 0x02, 5, 0x73 },
+		{ 0x55, 1, 0x74 }, { 0x43, 1, 0x74 }, { 0x5d, 1, 0x74 }, { 0x02, 5, 0x74 },
+		{ 0x42, 1, 0x20 }, { 0x01, 5, 0x20 }, { 0x42, 1, 0x25 }, { 0x01, 5, 0x25 },
+		{ 0x42, 1, 0x2d }, { 0x01, 5, 0x2d }, { 0x42, 1, 0x2e }, { 0x01, 5, 0x2e },
+	},
+	[0x45] = {
+		{ 0x55, 1, 0x20 }, { 0x43, 1, 0x20 }, { 0x5d, 1, 0x20 }, { 0x02, 5, 0x20 },
+		{ 0x55, 1, 0x25 }, { 0x43, 1, 0x25 }, { 0x5d, 1, 0x25 }, { 0x02, 5, 0x25 },
+		{ 0x55, 1, 0x2d }, { 0x43, 1, 0x2d }, { 0x5d, 1, 0x2d }, { 0x02, 5, 0x2d },
+		{ 0x55, 1, 0x2e }, { 0x43, 1, 0x2e }, { 0x5d, 1, 0x2e }, { 0x02, 5, 0x2e },
+	},
+	[0x46] = {
+		{ 0x56, 1, 0x20 }, { 0x82, 1, 0x20 }, { 0x44, 1, 0x20 }, { 0x52, 1, 0x20 },
+		{ 0x63, 1, 0x20 }, { 0x5e, 1, 0x20 }, { 0x68, 1, 0x20 }, { 0x03, 5, 0x20 },
+		{ 0x56, 1, 0x25 }, { 0x82, 1, 0x25 }, { 0x44, 1, 0x25 }, { 0x52, 1, 0x25 },
+		{ 0x63, 1, 0x25 }, { 0x5e, 1, 0x25 }, { 0x68, 1, 0x25 }, { 0x03, 5, 0x25 },
+	},
+	[0x47] = {
+		{ 0x55, 1, 0x21 }, { 0x43, 1, 0x21 }, { 0x5d, 1, 0x21 }, { 0x02, 5, 0x21 },
+		{ 0x55, 1, 0x22 }, { 0x43, 1, 0x22 }, { 0x5d, 1, 0x22 }, { 0x02, 5, 0x22 },
+		{ 0x55, 1, 0x28 }, { 0x43, 1, 0x28 }, { 0x5d, 1, 0x28 }, { 0x02, 5, 0x28 },
+		{ 0x55, 1, 0x29 }, { 0x43, 1, 0x29 }, { 0x5d, 1, 0x29 }, { 0x02, 5, 0x29 },
+	},
+	[0x48] = {
+		{ 0x56, 1, 0x21 }, { 0x82, 1, 0x21 }, { 0x44, 1, 0x21 }, { 0x52, 1, 0x21 },
+		{ 0x63, 1, 0x21 }, { 0x5e, 1, 0x21 }, { 0x68, 1, 0x21 }, { 0x03, 5, 0x21 },
+		{ 0x56, 1, 0x22 }, { 0x82, 1, 0x22 }, { 0x44, 1, 0x22 }, { 0x52, 1, 0x22 },
+		{ 0x63, 1, 0x22 }, { 0x5e, 1, 0x22 }, { 0x68, 1, 0x22 }, { 0x03, 5, 0x22 },
+	},
+	[0x49] = {
+		{ 0x56, 1, 0x7c }, { 0x82, 1, 0x7c }, { 0x44, 1, 0x7c }, { 0x52, 1, 0x7c },
+		{ 0x63, 1, 0x7c }, { 0x5e, 1, 0x7c }, { 0x68, 1, 0x7c }, { 0x03, 5, 0x7c },
+		{ 0x55, 1, 0x23 }, { 0x43, 1, 0x23 }, { 0x5d, 1, 0x23 }, { 0x02, 5, 0x23 },
+		{ 0x55, 1, 0x3e }, { 0x43, 1, 0x3e }, { 0x5d, 1, 0x3e }, { 0x02, 5, 0x3e },
+	},
+	[0x4a] = {
+		{ 0x56, 1, 0x23 }, { 0x82, 1, 0x23 }, { 0x44, 1, 0x23 }, { 0x52, 1, 0x23 },
+		{ 0x63, 1, 0x23 }, { 0x5e, 1, 0x23 }, { 0x68, 1, 0x23 }, { 0x03, 5, 0x23 },
+		{ 0x56, 1, 0x3e }, { 0x82, 1, 0x3e }, { 0x44, 1, 0x3e }, { 0x52, 1, 0x3e },
+		{ 0x63, 1, 0x3e }, { 0x5e, 1, 0x3e }, { 0x68, 1, 0x3e }, { 0x03, 5, 0x3e },
+	},
+	[0x4b] = {
+		{ 0x55, 1, 0x26 }, { 0x43, 1, 0x26 }, { 0x5d, 1, 0x26 }, { 0x02, 5, 0x26 },
+		{ 0x55, 1, 0x2a }, { 0x43, 1, 0x2a }, { 0x5d, 1, 0x2a }, { 0x02, 5, 0x2a },
+		{ 0x55, 1, 0x2c }, { 0x43, 1, 0x2c }, { 0x5d, 1, 0x2c }, { 0x02, 5, 0x2c },
+		{ 0x55, 1, 0x3b }, { 0x43, 1, 0x3b }, { 0x5d, 1, 0x3b }, { 0x02, 5, 0x3b },
+	},
+	[0x4c] = {
+		{ 0x56, 1, 0x26 }, { 0x82, 1, 0x26 }, { 0x44, 1, 0x26 }, { 0x52, 1, 0x26 },
+		{ 0x63, 1, 0x26 }, { 0x5e, 1, 0x26 }, { 0x68, 1, 0x26 }, { 0x03, 5, 0x26 },
+		{ 0x56, 1, 0x2a }, { 0x82, 1, 0x2a }, { 0x44, 1, 0x2a }, { 0x52, 1, 0x2a },
+		{ 0x63, 1, 0x2a }, { 0x5e, 1, 0x2a }, { 0x68, 1, 0x2a }, { 0x03, 5, 0x2a },
+	},
+	[0x4d] = {
+		{ 0x56, 1, 0x3f }, { 0x82, 1, 0x3f }, { 0x44, 1, 0x3f }, { 0x52, 1, 0x3f },
+		{ 0x63, 1, 0x3f }, { 0x5e, 1, 0x3f }, { 0x68, 1, 0x3f }, { 0x03, 5, 0x3f },
+		{ 0x55, 1, 0x27 }, { 0x43, 1, 0x27 }, { 0x5d, 1, 0x27 }, { 0x02, 5, 0x27 },
+		{ 0x55, 1, 0x2b }, { 0x43, 1, 0x2b }, { 0x5d, 1, 0x2b }, { 0x02, 5, 0x2b },
+	},
+	[0x4e] = {
+		{ 0x56, 1, 0x27 }, { 0x82, 1, 0x27 }, { 0x44, 1, 0x27 }, { 0x52, 1, 0x27 },
+		{ 0x63, 1, 0x27 }, { 0x5e, 1, 0x27 }, { 0x68, 1, 0x27 }, { 0x03, 5, 0x27 },
+		{ 0x56, 1, 0x2b }, { 0x82, 1, 0x2b }, { 0x44, 1, 0x2b }, { 0x52, 1, 0x2b },
+		{ 0x63, 1, 0x2b }, { 0x5e, 1, 0x2b }, { 0x68, 1, 0x2b }, { 0x03, 5, 0x2b },
+	},
+	[0x4f] = {
+		{ 0x56, 1, 0x28 }, { 0x82, 1, 0x28 }, { 0x44, 1, 0x28 }, { 0x52, 1, 0x28 },
+		{ 0x63, 1, 0x28 }, { 0x5e, 1, 0x28 }, { 0x68, 1, 0x28 }, { 0x03, 5, 0x28 },
+		{ 0x56, 1, 0x29 }, { 0x82, 1, 0x29 }, { 0x44, 1, 0x29 }, { 0x52, 1, 0x29 },
+		{ 0x63, 1, 0x29 }, { 0x5e, 1, 0x29 }, { 0x68, 1, 0x29 }, { 0x03, 5, 0x29 },
+	},
+	[0x50] = {
+		{ 0x56, 1, 0x2c }, { 0x82, 1, 0x2c }, { 0x44, 1, 0x2c }, { 0x52, 1, 0x2c },
+		{ 0x63, 1, 0x2c }, { 0x5e, 1, 0x2c }, { 0x68, 1, 0x2c }, { 0x03, 5, 0x2c },
+		{ 0x56, 1, 0x3b }, { 0x82, 1, 0x3b }, { 0x44, 1, 0x3b }, { 0x52, 1, 0x3b },
+		{ 0x63, 1, 0x3b }, { 0x5e, 1, 0x3b }, { 0x68, 1, 0x3b }, { 0x03, 5, 0x3b },
+	},
+	[0x51] = {
+		{ 0x56, 1, 0x2d }, { 0x82, 1, 0x2d }, { 0x44, 1, 0x2d }, { 0x52, 1, 0x2d },
+		{ 0x63, 1, 0x2d }, { 0x5e, 1, 0x2d }, { 0x68, 1, 0x2d }, { 0x03, 5, 0x2d },
+		{ 0x56, 1, 0x2e }, { 0x82, 1, 0x2e }, { 0x44, 1, 0x2e }, { 0x52, 1, 0x2e },
+		{ 0x63, 1, 0x2e }, { 0x5e, 1, 0x2e }, { 0x68, 1, 0x2e }, { 0x03, 5, 0x2e },
+	},
+	[0x52] = {
+		{ 0x42, 1, 0x2f }, { 0x01, 5, 0x2f }, { 0x42, 1, 0x33 }, { 0x01, 5, 0x33 },
+		{ 0x42, 1, 0x34 }, { 0x01, 5, 0x34 }, { 0x42, 1, 0x35 }, { 0x01, 5, 0x35 },
+		{ 0x42, 1, 0x36 }, { 0x01, 5, 0x36 }, { 0x42, 1, 0x37 }, { 0x01, 5, 0x37 },
+		{ 0x42, 1, 0x38 }, { 0x01, 5, 0x38 }, { 0x42, 1, 0x39 }, { 0x01, 5, 0x39 },
+	},
+	[0x53] = {
+		{ 0x55, 1, 0x2f }, { 0x43, 1, 0x2f }, { 0x5d, 1, 0x2f }, { 0x02, 5, 0x2f },
+		{ 0x55, 1, 0x33 }, { 0x43, 1, 0x33 }, { 0x5d, 1, 0x33 }, { 0x02, 5, 0x33 },
+		{ 0x55, 1, 0x34 }, { 0x43, 1, 0x34 }, { 0x5d, 1, 0x34 }, { 0x02, 5, 0x34 },
+		{ 0x55, 1, 0x35 }, { 0x43, 1, 0x35 }, { 0x5d, 1, 0x35 }, { 0x02, 5, 0x35 },
+	},
+	[0x54] = {
+		{ 0x56, 1, 0x2f }, { 0x82, 1, 0x2f }, { 0x44, 1, 0x2f }, { 0x52, 1, 0x2f },
+		{ 0x63, 1, 0x2f }, { 0x5e, 1, 0x2f }, { 0x68, 1, 0x2f }, { 0x03, 5, 0x2f },
+		{ 0x56, 1, 0x33 }, { 0x82, 1, 0x33 }, { 0x44, 1, 0x33 }, { 0x52, 1, 0x33 },
+		{ 0x63, 1, 0x33 }, { 0x5e, 1, 0x33 }, { 0x68, 1, 0x33 }, { 0x03, 5, 0x33 },
+	},
+	[0x55] = {
+		{ 0x42, 1, 0x30 }, { 0x01, 5, 0x30 }, { 0x42, 1, 0x31 }, { 0x01, 5, 0x31 },
+		{ 0x42, 1, 0x32 }, { 0x01, 5, 0x32 }, { 0x42, 1, 0x61 }, { 0x01, 5, 0x61 },
+		{ 0x42, 1, 0x63 }, { 0x01, 5, 0x63 }, { 0x42, 1, 0x65 }, { 0x01, 5, 0x65 },
+		{ 0x42, 1, 0x69 }, { 0x01, 5, 0x69 }, { 0x42, 1, 0x6f }, { 0x01, 5, 0x6f },
+	},
+	[0x56] = {
+		{ 0x55, 1, 0x30 }, { 0x43, 1, 0x30 }, { 0x5d, 1, 0x30 }, { 0x02, 5, 0x30 },
+		{ 0x55, 1, 0x31 }, { 0x43, 1, 0x31 }, { 0x5d, 1, 0x31 }, { 0x02, 5, 0x31 },
+		{ 0x55, 1, 0x32 }, { 0x43, 1, 0x32 }, { 0x5d, 1, 0x32 }, { 0x02, 5, 0x32 },
+		{ 0x55, 1, 0x61 }, { 0x43, 1, 0x61 }, { 0x5d, 1, 0x61 }, { 0x02, 5, 0x61 },
+	},
+	[0x57] = {
+		{ 0x56, 1, 0x30 }, { 0x82, 1, 0x30 }, { 0x44, 1, 0x30 }, { 0x52, 1, 0x30 },
+		{ 0x63, 1, 0x30 }, { 0x5e, 1, 0x30 }, { 0x68, 1, 0x30 }, { 0x03, 5, 0x30 },
+		{ 0x56, 1, 0x31 }, { 0x82, 1, 0x31 }, { 0x44, 1, 0x31 }, { 0x52, 1, 0x31 },
+		{ 0x63, 1, 0x31 }, { 0x5e, 1, 0x31 }, { 0x68, 1, 0x31 }, { 0x03, 5, 0x31 },
+	},
+	[0x58] = {
+		{ 0x56, 1, 0x32 }, { 0x82, 1, 0x32 }, { 0x44, 1, 0x32 }, { 0x52, 1, 0x32 },
+		{ 0x63, 1, 0x32 }, { 0x5e, 1, 0x32 }, { 0x68, 1, 0x32 }, { 0x03, 5, 0x32 },
+		{ 0x56, 1, 0x61 }, { 0x82, 1, 0x61 }, { 0x44, 1, 0x61 }, { 0x52, 1, 0x61 },
+		{ 0x63, 1, 0x61 }, { 0x5e, 1, 0x61 }, { 0x68, 1, 0x61 }, { 0x03, 5, 0x61 },
+	},
+	[0x59] = {
+		{ 0x56, 1, 0x34 }, { 0x82, 1, 0x34 }, { 0x44, 1, 0x34 }, { 0x52, 1, 0x34 },
+		{ 0x63, 1, 0x34 }, { 0x5e, 1, 0x34 }, { 0x68, 1, 0x34 }, { 0x03, 5, 0x34 },
+		{ 0x56, 1, 0x35 }, { 0x82, 1, 0x35 }, { 0x44, 1, 0x35 }, { 0x52, 1, 0x35 },
+		{ 0x63, 1, 0x35 }, { 0x5e, 1, 0x35 }, { 0x68, 1, 0x35 }, { 0x03, 5, 0x35 },
+	},
+	[0x5a] = {
+		{ 0x55, 1, 0x36 }, { 0x43, 1, 0x36 }, { 0x5d, 1, 0x36 }, { 0x02, 5, 0x36 },
+		{ 0x55, 1, 0x37 }, { 0x43, 1, 0x37 }, { 0x5d, 1, 0x37 }, { 0x02, 5, 0x37 },
+		{ 0x55, 1, 0x38 }, { 0x43, 1, 0x38 }, { 0x5d, 1, 0x38 }, { 0x02, 5, 0x38 },
+		{ 0x55, 1, 0x39 }, { 0x43, 1, 0x39 }, { 0x5d, 1, 0x39 }, { 0x02, 5, 0x39 },
+	},
+	[0x5b] = {
+		{ 0x56, 1, 0x36 }, { 0x82, 1, 0x36 }, { 0x44, 1, 0x36 }, { 0x52, 1, 0x36 },
+		{ 0x63, 1, 0x36 }, { 0x5e, 1, 0x36 }, { 0x68, 1, 0x36 }, { 0x03, 5, 0x36 },
+		{ 0x56, 1, 0x37 }, { 0x82, 1, 0x37 }, { 0x44, 1, 0x37 }, { 0x52, 1, 0x37 },
+		{ 0x63, 1, 0x37 }, { 0x5e, 1, 0x37 }, { 0x68, 1, 0x37 }, { 0x03, 5, 0x37 },
+	},
+	[0x5c] = {
+		{ 0x56, 1, 0x38 }, { 0x82, 1, 0x38 }, { 0x44, 1, 0x38 }, { 0x52, 1, 0x38 },
+		{ 0x63, 1, 0x38 }, { 0x5e, 1, 0x38 }, { 0x68, 1, 0x38 }, { 0x03, 5, 0x38 },
+		{ 0x56, 1, 0x39 }, { 0x82, 1, 0x39 }, { 0x44, 1, 0x39 }, { 0x52, 1, 0x39 },
+		{ 0x63, 1, 0x39 }, { 0x5e, 1, 0x39 }, { 0x68, 1, 0x39 }, { 0x03, 5, 0x39 },
+	},
+	[0x5d] = {
+		{ 0x00, 5, 0x3d }, { 0x00, 5, 0x41 }, { 0x00, 5, 0x5f }, { 0x00, 5, 0x62 },
+		{ 0x00, 5, 0x64 }, { 0x00, 5, 0x66 }, { 0x00, 5, 0x67 }, { 0x00, 5, 0x68 },
+		{ 0x00, 5, 0x6c }, { 0x00, 5, 0x6d }, { 0x00, 5, 0x6e }, { 0x00, 5, 0x70 },
+		{ 0x00, 5, 0x72 }, { 0x00, 5, 0x75 }, { 0x61, 0, 0x00 }, { 0x67, 0, 0x00 },
+	},
+	[0x5e] = {
+		{ 0x42, 1, 0x6c }, { 0x01, 5, 0x6c }, { 0x42, 1, 0x6d }, { 0x01, 5, 0x6d },
+		{ 0x42, 1, 0x6e }, { 0x01, 5, 0x6e }, { 0x42, 1, 0x70 }, { 0x01, 5, 0x70 },
+		{ 0x42, 1, 0x72 }, { 0x01, 5, 0x72 }, { 0x42, 1, 0x75 }, { 0x01, 5, 0x75 },
+		{ 0x00, 5, 0x3a }, { 0x00, 5, 0x42 }, { 0x00, 5, 0x43 }, { 0x00, 5, 0x44 },
+	},
+	[0x5f] = {
+		{ 0x55, 1, 0x72 }, { 0x43, 1, 0x72 }, { 0x5d, 1, 0x72 }, { 0x02, 5, 0x72 },
+		{ 0x55, 1, 0x75 }, { 0x43, 1, 0x75 }, { 0x5d, 1, 0x75 }, { 0x02, 5, 0x75 },
+		{ 0x42, 1, 0x3a }, { 0x01, 5, 0x3a }, { 0x42, 1, 0x42 }, { 0x01, 5, 0x42 },
+		{ 0x42, 1, 0x43 }, { 0x01, 5, 0x43 }, { 0x42, 1, 0x44 }, { 0x01, 5, 0x44 },
+	},
+	[0x60] = {
+		{ 0x55, 1, 0x3a }, { 0x43, 1, 0x3a }, { 0x5d, 1, 0x3a }, { 0x02, 5, 0x3a },
+		{ 0x55, 1, 0x42 }, { 0x43, 1, 0x42 }, { 0x5d, 1, 0x42 }, { 0x02, 5, 0x42 },
+		{ 0x55, 1, 0x43 }, { 0x43, 1, 0x43 }, { 0x5d, 1, 0x43 }, { 0x02, 5, 0x43 },
+		{ 0x55, 1, 0x44 }, { 0x43, 1, 0x44 }, { 0x5d, 1, 0x44 }, { 0x02, 5, 0x44 },
+	},
+	[0x61] = {
+		{ 0x56, 1, 0x3a }, { 0x82, 1, 0x3a }, { 0x44, 1, 0x3a }, { 0x52, 1, 0x3a },
+		{ 0x63, 1, 0x3a }, { 0x5e, 1, 0x3a }, { 0x68, 1, 0x3a }, { 0x03, 5, 0x3a },
+		{ 0x56, 1, 0x42 }, { 0x82, 1, 0x42 }, { 0x44, 1, 0x42 }, { 0x52, 1, 0x42 },
+		{ 0x63, 1, 0x42 }, { 0x5e, 1, 0x42 }, { 0x68, 1, 0x42 }, { 0x03, 5, 0x42 },
+	},
+	[0x62] = {
+		{ 0x56, 1, 0x3c }, { 0x82, 1, 0x3c }, { 0x44, 1, 0x3c }, { 0x52, 1, 0x3c },
+		{ 0x63, 1, 0x3c }, { 0x5e, 1, 0x3c }, { 0x68, 1, 0x3c }, { 0x03, 5, 0x3c },
+		{ 0x56, 1, 0x60 }, { 0x82, 1, 0x60 }, { 0x44, 1, 0x60 }, { 0x52, 1, 0x60 },
+		{ 0x63, 1, 0x60 }, { 0x5e, 1, 0x60 }, { 0x68, 1, 0x60 }, { 0x03, 5, 0x60 },
+	},
+	[0x63] = {
+		{ 0x42, 1, 0x3d }, { 0x01, 5, 0x3d }, { 0x42, 1, 0x41 }, { 0x01, 5, 0x41 },
+		{ 0x42, 1, 0x5f }, { 0x01, 5, 0x5f }, { 0x42, 1, 0x62 }, { 0x01, 5, 0x62 },
+		{ 0x42, 1, 0x64 }, { 0x01, 5, 0x64 }, { 0x42, 1, 0x66 }, { 0x01, 5, 0x66 },
+		{ 0x42, 1, 0x67 }, { 0x01, 5, 0x67 }, { 0x42, 1, 0x68 }, { 0x01, 5, 0x68 },
+	},
+	[0x64] = {
+		{ 0x55, 1, 0x3d }, { 0x43, 1, 0x3d }, { 0x5d, 1, 0x3d }, { 0x02, 5, 0x3d },
+		{ 0x55, 1, 0x41 }, { 0x43, 1, 0x41 }, { 0x5d, 1, 0x41 }, { 0x02, 5, 0x41 },
+		{ 0x55, 1, 0x5f }, { 0x43, 1, 0x5f }, { 0x5d, 1, 0x5f }, { 0x02, 5, 0x5f },
+		{ 0x55, 1, 0x62 }, { 0x43, 1, 0x62 }, { 0x5d, 1, 0x62 }, { 0x02, 5, 0x62 },
+	},
+	[0x65] = {
+		{ 0x56, 1, 0x3d }, { 0x82, 1, 0x3d }, { 0x44, 1, 0x3d }, { 0x52, 1, 0x3d },
+		{ 0x63, 1, 0x3d }, { 0x5e, 1, 0x3d }, { 0x68, 1, 0x3d }, { 0x03, 5, 0x3d },
+		{ 0x56, 1, 0x41 }, { 0x82, 1, 0x41 }, { 0x44, 1, 0x41 }, { 0x52, 1, 0x41 },
+		{ 0x63, 1, 0x41 }, { 0x5e, 1, 0x41 }, { 0x68, 1, 0x41 }, { 0x03, 5, 0x41 },
+	},
+	[0x66] = {
+		{ 0x56, 1, 0x40 }, { 0x82, 1, 0x40 }, { 0x44, 1, 0x40 }, { 0x52, 1, 0x40 },
+		{ 0x63, 1, 0x40 }, { 0x5e, 1, 0x40 }, { 0x68, 1, 0x40 }, { 0x03, 5, 0x40 },
+		{ 0x56, 1, 0x5b }, { 0x82, 1, 0x5b }, { 0x44, 1, 0x5b }, { 0x52, 1, 0x5b },
+		{ 0x63, 1, 0x5b }, { 0x5e, 1, 0x5b }, { 0x68, 1, 0x5b }, { 0x03, 5, 0x5b },
+	},
+	[0x67] = {
+		{ 0x56, 1, 0x43 }, { 0x82, 1, 0x43 }, { 0x44, 1, 0x43 }, { 0x52, 1, 0x43 },
+		{ 0x63, 1, 0x43 }, { 0x5e, 1, 0x43 }, { 0x68, 1, 0x43 }, { 0x03, 5, 0x43 },
+		{ 0x56, 1, 0x44 }, { 0x82, 1, 0x44 }, { 0x44, 1, 0x44 }, { 0x52, 1, 0x44 },
+		{ 0x63, 1, 0x44 }, { 0x5e, 1, 0x44 }, { 0x68, 1, 0x44 }, { 0x03, 5, 0x44 },
+	},
+	[0x68] = {
+		{ 0x00, 5, 0x45 }, { 0x00, 5, 0x46 }, { 0x00, 5, 0x47 }, { 0x00, 5, 0x48 },
+		{ 0x00, 5, 0x49 }, { 0x00, 5, 0x4a }, { 0x00, 5, 0x4b }, { 0x00, 5, 0x4c },
+		{ 0x00, 5, 0x4d }, { 0x00, 5, 0x4e }, { 0x00, 5, 0x4f }, { 0x00, 5, 0x50 },
+		{ 0x00, 5, 0x51 }, { 0x00, 5, 0x52 }, { 0x00, 5, 0x53 }, { 0x00, 5, 0x54 },
+	},
+	[0x69] = {
+		{ 0x42, 1, 0x45 }, { 0x01, 5, 0x45 }, { 0x42, 1, 0x46 }, { 0x01, 5, 0x46 },
+		{ 0x42, 1, 0x47 }, { 0x01, 5, 0x47 }, { 0x42, 1, 0x48 }, { 0x01, 5, 0x48 },
+		{ 0x42, 1, 0x49 }, { 0x01, 5, 0x49 }, { 0x42, 1, 0x4a }, { 0x01, 5, 0x4a },
+		{ 0x42, 1, 0x4b }, { 0x01, 5, 0x4b }, { 0x42, 1, 0x4c }, { 0x01, 5, 0x4c },
+	},
+	[0x6a] = {
+		{ 0x55, 1, 0x45 }, { 0x43, 1, 0x45 }, { 0x5d, 1, 0x45 }, { 0x02, 5, 0x45 },
+		{ 0x55, 1, 0x46 }, { 0x43, 1, 0x46 }, { 0x5d, 1, 0x46 }, { 0x02, 5, 0x46 },
+		{ 0x55, 1, 0x47 }, { 0x43, 1, 0x47 }, { 0x5d, 1, 0x47 }, { 0x02, 5, 0x47 },
+		{ 0x55, 1, 0x48 }, { 0x43, 1, 0x48 }, { 0x5d, 1, 0x48 }, { 0x02, 5, 0x48 },
+	},
+	[0x6b] = {
+		{ 0x56, 1, 0x45 }, { 0x82, 1, 0x45 }, { 0x44, 1, 0x45 }, { 0x52, 1, 0x45 },
+		{ 0x63, 1, 0x45 }, { 0x5e, 1, 0x45 }, { 0x68, 1, 0x45 }, { 0x03, 5, 0x45 },
+		{ 0x56, 1, 0x46 }, { 0x82, 1, 0x46 }, { 0x44, 1, 0x46 }, { 0x52, 1, 0x46 },
+		{ 0x63, 1, 0x46 }, { 0x5e, 1, 0x46 }, { 0x68, 1, 0x46 }, { 0x03, 5, 0x46 },
+	},
+	[0x6c] = {
+		{ 0x56, 1, 0x47 }, { 0x82, 1, 0x47 }, { 0x44, 1, 0x47 }, { 0x52, 1, 0x47 },
+		{ 0x63, 1, 0x47 }, { 0x5e, 1, 0x47 }, { 0x68, 1, 0x47 }, { 0x03, 5, 0x47 },
+		{ 0x56, 1, 0x48 }, { 0x82, 1, 0x48 }, { 0x44, 1, 0x48 }, { 0x52, 1, 0x48 },
+		{ 0x63, 1, 0x48 }, { 0x5e, 1, 0x48 }, { 0x68, 1, 0x48 }, { 0x03, 5, 0x48 },
+	},
+	[0x6d] = {
+		{ 0x55, 1, 0x49 }, { 0x43, 1, 0x49 }, { 0x5d, 1, 0x49 }, { 0x02, 5, 0x49 },
+		{ 0x55, 1, 0x4a }, { 0x43, 1, 0x4a }, { 0x5d, 1, 0x4a }, { 0x02, 5, 0x4a },
+		{ 0x55, 1, 0x4b }, { 0x43, 1, 0x4b }, { 0x5d, 1, 0x4b }, { 0x02, 5, 0x4b },
+		{ 0x55, 1, 0x4c }, { 0x43, 1, 0x4c }, { 0x5d, 1, 0x4c }, { 0x02, 5, 0x4c },
+	},
+	[0x6e] = {
+		{ 0x56, 1, 0x49 }, { 0x82, 1, 0x49 }, { 0x44, 1, 0x49 }, { 0x52, 1, 0x49 },
+		{ 0x63, 1, 0x49 }, { 0x5e, 1, 0x49 }, { 0x68, 1, 0x49 }, { 0x03, 5, 0x49 },
+		{ 0x56, 1, 0x4a }, { 0x82, 1, 0x4a }, { 0x44, 1, 0x4a }, { 0x52, 1, 0x4a },
+		{ 0x63, 1, 0x4a }, { 0x5e, 1, 0x4a }, { 0x68, 1, 0x4a }, { 0x03, 5, 0x4a },
+	},
+	[0x6f] = {
+		{ 0x56, 1, 0x4b }, { 0x82, 1, 0x4b }, { 0x44, 1, 0x4b }, { 0x52, 1, 0x4b },
+		{ 0x63, 1, 0x4b }, { 0x5e, 1, 0x4b }, { 0x68, 1, 0x4b }, { 0x03, 5, 0x4b },
+		{ 0x56, 1, 0x4c }, { 0x82, 1, 0x4c }, { 0x44, 1, 0x4c }, { 0x52, 1, 0x4c },
+		{ 0x63, 1, 0x4c }, { 0x5e, 1, 0x4c }, { 0x68, 1, 0x4c }, { 0x03, 5, 0x4c },
+	},
+	[0x70] = {
+		{ 0x42, 1, 0x4d }, { 0x01, 5, 0x4d }, { 0x42, 1, 0x4e }, { 0x01, 5, 0x4e },
+		{ 0x42, 1, 0x4f }, { 0x01, 5, 0x4f }, { 0x42, 1, 0x50 }, { 0x01, 5, 0x50 },
+		{ 0x42, 1, 0x51 }, { 0x01, 5, 0x51 }, { 0x42, 1, 0x52 }, { 0x01, 5, 0x52 },
+		{ 0x42, 1, 0x53 }, { 0x01, 5, 0x53 }, { 0x42, 1, 0x54 }, { 0x01, 5, 0x54 },
+	},
+	[0x71] = {
+		{ 0x55, 1, 0x4d }, { 0x43, 1, 0x4d }, { 0x5d, 1, 0x4d }, { 0x02, 5, 0x4d },
+		{ 0x55, 1, 0x4e }, { 0x43, 1, 0x4e }, { 0x5d, 1, 0x4e }, { 0x02, 5, 0x4e },
+		{ 0x55, 1, 0x4f }, { 0x43, 1, 0x4f }, { 0x5d, 1, 0x4f }, { 0x02, 5, 0x4f },
+		{ 0x55, 1, 0x50 }, { 0x43, 1, 0x50 }, { 0x5d, 1, 0x50 }, { 0x02, 5, 0x50 },
+	},
+	[0x72] = {
+		{ 0x56, 1, 0x4d }, { 0x82, 1, 0x4d }, { 0x44, 1, 0x4d }, { 0x52, 1, 0x4d },
+		{ 0x63, 1, 0x4d }, { 0x5e, 1, 0x4d }, { 0x68, 1, 0x4d }, { 0x03, 5, 0x4d },
+		{ 0x56, 1, 0x4e }, { 0x82, 1, 0x4e }, { 0x44, 1, 0x4e }, { 0x52, 1, 0x4e },
+		{ 0x63, 1, 0x4e }, { 0x5e, 1, 0x4e }, { 0x68, 1, 0x4e }, { 0x03, 5, 0x4e },
+	},
+	[0x73] = {
+		{ 0x56, 1, 0x4f }, { 0x82, 1, 0x4f }, { 0x44, 1, 0x4f }, { 0x52, 1, 0x4f },
+		{ 0x63, 1, 0x4f }, { 0x5e, 1, 0x4f }, { 0x68, 1, 0x4f }, { 0x03, 5, 0x4f },
+		{ 0x56, 1, 0x50 }, { 0x82, 1, 0x50 }, { 0x44, 1, 0x50 }, { 0x52, 1, 0x50 },
+		{ 0x63, 1, 0x50 }, { 0x5e, 1, 0x50 }, { 0x68, 1, 0x50 }, { 0x03, 5, 0x50 },
+	},
+	[0x74] = {
+		{ 0x55, 1, 0x51 }, { 0x43, 1, 0x51 }, { 0x5d, 1, 0x51 }, { 0x02, 5, 0x51 },
+		{ 0x55, 1, 0x52 }, { 0x43, 1, 0x52 }, { 0x5d, 1, 0x52 }, { 0x02, 5, 0x52 },
+		{ 0x55, 1, 0x53 }, { 0x43, 1, 0x53 }, { 0x5d, 1, 0x53 }, { 0x02, 5, 0x53 },
+		{ 0x55, 1, 0x54 }, { 0x43, 1, 0x54 }, { 0x5d, 1, 0x54 }, { 0x02, 5, 0x54 },
+	},
+	[0x75] = {
+		{ 0x56, 1, 0x51 }, { 0x82, 1, 0x51 }, { 0x44, 1, 0x51 }, { 0x52, 1, 0x51 },
+		{ 0x63, 1, 0x51 }, { 0x5e, 1, 0x51 }, { 0x68, 1, 0x51 }, { 0x03, 5, 0x51 },
+		{ 0x56, 1, 0x52 }, { 0x82, 1, 0x52 }, { 0x44, 1, 0x52 }, { 0x52, 1, 0x52 },
+		{ 0x63, 1, 0x52 }, { 0x5e, 1, 0x52 }, { 0x68, 1, 0x52 }, { 0x03, 5, 0x52 },
+	},
+	[0x76] = {
+		{ 0x56, 1, 0x53 }, { 0x82, 1, 0x53 }, { 0x44, 1, 0x53 }, { 0x52, 1, 0x53 },
+		{ 0x63, 1, 0x53 }, { 0x5e, 1, 0x53 }, { 0x68, 1, 0x53 }, { 0x03, 5, 0x53 },
+		{ 0x56, 1, 0x54 }, { 0x82, 1, 0x54 }, { 0x44, 1, 0x54 }, { 0x52, 1, 0x54 },
+		{ 0x63, 1, 0x54 }, { 0x5e, 1, 0x54 }, { 0x68, 1, 0x54 }, { 0x03, 5, 0x54 },
+	},
+	[0x77] = {
+		{ 0x42, 1, 0x55 }, { 0x01, 5, 0x55 }, { 0x42, 1, 0x56 }, { 0x01, 5, 0x56 },
+		{ 0x42, 1, 0x57 }, { 0x01, 5, 0x57 }, { 0x42, 1, 0x59 }, { 0x01, 5, 0x59 },
+		{ 0x42, 1, 0x6a }, { 0x01, 5, 0x6a }, { 0x42, 1, 0x6b }, { 0x01, 5, 0x6b },
+		{ 0x42, 1, 0x71 }, { 0x01, 5, 0x71 }, { 0x42, 1, 0x76 }, { 0x01, 5, 0x76 },
+	},
+	[0x78] = {
+		{ 0x55, 1, 0x55 }, { 0x43, 1, 0x55 }, { 0x5d, 1, 0x55 }, { 0x02, 5, 0x55 },
+		{ 0x55, 1, 0x56 }, { 0x43, 1, 0x56 }, { 0x5d, 1, 0x56 }, { 0x02, 5, 0x56 },
+		{ 0x55, 1, 0x57 }, { 0x43, 1, 0x57 }, { 0x5d, 1, 0x57 }, { 0x02, 5, 0x57 },
+		{ 0x55, 1, 0x59 }, { 0x43, 1, 0x59 }, { 0x5d, 1, 0x59 }, { 0x02, 5, 0x59 },
+	},
+	[0x79] = {
+		{ 0x56, 1, 0x55 }, { 0x82, 1, 0x55 }, { 0x44, 1, 0x55 }, { 0x52, 1, 0x55 },
+		{ 0x63, 1, 0x55 }, { 0x5e, 1, 0x55 }, { 0x68, 1, 0x55 }, { 0x03, 5, 0x55 },
+		{ 0x56, 1, 0x56 }, { 0x82, 1, 0x56 }, { 0x44, 1, 0x56 }, { 0x52, 1, 0x56 },
+		{ 0x63, 1, 0x56 }, { 0x5e, 1, 0x56 }, { 0x68, 1, 0x56 }, { 0x03, 5, 0x56 },
+	},
+	[0x7a] = {
+		{ 0x56, 1, 0x57 }, { 0x82, 1, 0x57 }, { 0x44, 1, 0x57 }, { 0x52, 1, 0x57 },
+		{ 0x63, 1, 0x57 }, { 0x5e, 1, 0x57 }, { 0x68, 1, 0x57 }, { 0x03, 5, 0x57 },
+		{ 0x56, 1, 0x59 }, { 0x82, 1, 0x59 }, { 0x44, 1, 0x59 }, { 0x52, 1, 0x59 },
+		{ 0x63, 1, 0x59 }, { 0x5e, 1, 0x59 }, { 0x68, 1, 0x59 }, { 0x03, 5, 0x59 },
+	},
+	[0x7b] = {
+		{ 0x56, 1, 0x58 }, { 0x82, 1, 0x58 }, { 0x44, 1, 0x58 }, { 0x52, 1, 0x58 },
+		{ 0x63, 1, 0x58 }, { 0x5e, 1, 0x58 }, { 0x68, 1, 0x58 }, { 0x03, 5, 0x58 },
+		{ 0x56, 1, 0x5a }, { 0x82, 1, 0x5a }, { 0x44, 1, 0x5a }, { 0x52, 1, 0x5a },
+		{ 0x63, 1, 0x5a }, { 0x5e, 1, 0x5a }, { 0x68, 1, 0x5a }, { 0x03, 5, 0x5a },
+	},
+	[0x7c] = {
+		{ 0x42, 1, 0x5c }, { 0x01, 5, 0x5c }, { 0x42, 1, 0xc3 }, { 0x01, 5, 0xc3 },
+		{ 0x42, 1, 0xd0 }, { 0x01, 5, 0xd0 }, { 0x00, 5, 0x80 }, { 0x00, 5, 0x82 },
+		{ 0x00, 5, 0x83 }, { 0x00, 5, 0xa2 }, { 0x00, 5, 0xb8 }, { 0x00, 5, 0xc2 },
+		{ 0x00, 5, 0xe0 }, { 0x00, 5, 0xe2 }, { 0xb1, 0, 0x00 }, { 0xbc, 0, 0x00 },
+	},
+	[0x7d] = {
+		{ 0x55, 1, 0x5c }, { 0x43, 1, 0x5c }, { 0x5d, 1, 0x5c }, { 0x02, 5, 0x5c },
+		{ 0x55, 1, 0xc3 }, { 0x43, 1, 0xc3 }, { 0x5d, 1, 0xc3 }, { 0x02, 5, 0xc3 },
+		{ 0x55, 1, 0xd0 }, { 0x43, 1, 0xd0 }, { 0x5d, 1, 0xd0 }, { 0x02, 5, 0xd0 },
+		{ 0x42, 1, 0x80 }, { 0x01, 5, 0x80 }, { 0x42, 1, 0x82 }, { 0x01, 5, 0x82 },
+	},
+	[0x7e] = {
+		{ 0x56, 1, 0x5c }, { 0x82, 1, 0x5c }, { 0x44, 1, 0x5c }, { 0x52, 1, 0x5c },
+		{ 0x63, 1, 0x5c }, { 0x5e, 1, 0x5c }, { 0x68, 1, 0x5c }, { 0x03, 5, 0x5c },
+		{ 0x56, 1, 0xc3 }, { 0x82, 1, 0xc3 }, { 0x44, 1, 0xc3 }, { 0x52, 1, 0xc3 },
+		{ 0x63, 1, 0xc3 }, { 0x5e, 1, 0xc3 }, { 0x68, 1, 0xc3 }, { 0x03, 5, 0xc3 },
+	},
+	[0x7f] = {
+		{ 0x56, 1, 0x5d }, { 0x82, 1, 0x5d }, { 0x44, 1, 0x5d }, { 0x52, 1, 0x5d },
+		{ 0x63, 1, 0x5d }, { 0x5e, 1, 0x5d }, { 0x68, 1, 0x5d }, { 0x03, 5, 0x5d },
+		{ 0x56, 1, 0x7e }, { 0x82, 1, 0x7e }, { 0x44, 1, 0x7e }, { 0x52, 1, 0x7e },
+		{ 0x63, 1, 0x7e }, { 0x5e, 1, 0x7e }, { 0x68, 1, 0x7e }, { 0x03, 5, 0x7e },
+	},
+	[0x80] = {
+		{ 0x56, 1, 0x5e }, { 0x82, 1, 0x5e }, { 0x44, 1, 0x5e }, { 0x52, 1, 0x5e },
+		{ 0x63, 1, 0x5e }, { 0x5e, 1, 0x5e }, { 0x68, 1, 0x5e }, { 0x03, 5, 0x5e },
+		{ 0x56, 1, 0x7d }, { 0x82, 1, 0x7d }, { 0x44, 1, 0x7d }, { 0x52, 1, 0x7d },
+		{ 0x63, 1, 0x7d }, { 0x5e, 1, 0x7d }, { 0x68, 1, 0x7d }, { 0x03, 5, 0x7d },
+	},
+	[0x81] = {
+		{ 0x56, 1, 0x5f }, { 0x82, 1, 0x5f }, { 0x44, 1, 0x5f }, { 0x52, 1, 0x5f },
+		{ 0x63, 1, 0x5f }, { 0x5e, 1, 0x5f }, { 0x68, 1, 0x5f }, { 0x03, 5, 0x5f },
+		{ 0x56, 1, 0x62 }, { 0x82, 1, 0x62 }, { 0x44, 1, 0x62 }, { 0x52, 1, 0x62 },
+		{ 0x63, 1, 0x62 }, { 0x5e, 1, 0x62 }, { 0x68, 1, 0x62 }, { 0x03, 5, 0x62 },
+	},
+	[0x82] = {
+		{ 0x55, 1, 0x63 }, { 0x43, 1, 0x63 }, { 0x5d, 1, 0x63 }, { 0x02, 5, 0x63 },
+		{ 0x55, 1, 0x65 }, { 0x43, 1, 0x65 }, { 0x5d, 1, 0x65 }, { 0x02, 5, 0x65 },
+		{ 0x55, 1, 0x69 }, { 0x43, 1, 0x69 }, { 0x5d, 1, 0x69 }, { 0x02, 5, 0x69 },
+		{ 0x55, 1, 0x6f }, { 0x43, 1, 0x6f }, { 0x5d, 1, 0x6f }, { 0x02, 5, 0x6f },
+	},
+	[0x83] = {
+		{ 0x56, 1, 0x63 }, { 0x82, 1, 0x63 }, { 0x44, 1, 0x63 }, { 0x52, 1, 0x63 },
+		{ 0x63, 1, 0x63 }, { 0x5e, 1, 0x63 }, { 0x68, 1, 0x63 }, { 0x03, 5, 0x63 },
+		{ 0x56, 1, 0x65 }, { 0x82, 1, 0x65 }, { 0x44, 1, 0x65 }, { 0x52, 1, 0x65 },
+		{ 0x63, 1, 0x65 }, { 0x5e, 1, 0x65 }, { 0x68, 1, 0x65 }, { 0x03, 5, 0x65 },
+	},
+	[0x84] = {
+		{ 0x55, 1, 0x64 }, { 0x43, 1, 0x64 }, { 0x5d, 1, 0x64 }, { 0x02, 5, 0x64 },
+		{ 0x55, 1, 0x66 }, { 0x43, 1, 0x66 }, { 0x5d, 1, 0x66 }, { 0x02, 5, 0x66 },
+		{ 0x55, 1, 0x67 }, { 0x43, 1, 0x67 }, { 0x5d, 1, 0x67 }, { 0x02, 5, 0x67 },
+		{ 0x55, 1, 0x68 }, { 0x43, 1, 0x68 }, { 0x5d, 1, 0x68 }, { 0x02, 5, 0x68 },
+	},
+	[0x85] = {
+		{ 0x56, 1, 0x64 }, { 0x82, 1, 0x64 }, { 0x44, 1, 0x64 }, { 0x52, 1, 0x64 },
+		{ 0x63, 1, 0x64 }, { 0x5e, 1, 0x64 }, { 0x68, 1, 0x64 }, { 0x03, 5, 0x64 },
+		{ 0x56, 1, 0x66 }, { 0x82, 1, 0x66 }, { 0x44, 1, 0x66 }, { 0x52, 1, 0x66 },
+		{ 0x63, 1, 0x66 }, { 0x5e, 1, 0x66 }, { 0x68, 1, 0x66 }, { 0x03, 5, 0x66 },
+	},
+	[0x86] = {
+		{ 0x56, 1, 0x67 }, { 0x82, 1, 0x67 }, { 0x44, 1, 0x67 }, { 0x52, 1, 0x67 },
+		{ 0x63, 1, 0x67 }, { 0x5e, 1, 0x67 }, { 0x68, 1, 0x67 }, { 0x03, 5, 0x67 },
+		{ 0x56, 1, 0x68 }, { 0x82, 1, 0x68 }, { 0x44, 1, 0x68 }, { 0x52, 1, 0x68 },
+		{ 0x63, 1, 0x68 }, { 0x5e, 1, 0x68 }, { 0x68, 1, 0x68 }, { 0x03, 5, 0x68 },
+	},
+	[0x87] = {
+		{ 0x56, 1, 0x69 }, { 0x82, 1, 0x69 }, { 0x44, 1, 0x69 }, { 0x52, 1, 0x69 },
+		{ 0x63, 1, 0x69 }, { 0x5e, 1, 0x69 }, { 0x68, 1, 0x69 }, { 0x03, 5, 0x69 },
+		{ 0x56, 1, 0x6f }, { 0x82, 1, 0x6f }, { 0x44, 1, 0x6f }, { 0x52, 1, 0x6f },
+		{ 0x63, 1, 0x6f }, { 0x5e, 1, 0x6f }, { 0x68, 1, 0x6f }, { 0x03, 5, 0x6f },
+	},
+	[0x88] = {
+		{ 0x55, 1, 0x6a }, { 0x43, 1, 0x6a }, { 0x5d, 1, 0x6a }, { 0x02, 5, 0x6a },
+		{ 0x55, 1, 0x6b }, { 0x43, 1, 0x6b }, { 0x5d, 1, 0x6b }, { 0x02, 5, 0x6b },
+		{ 0x55, 1, 0x71 }, { 0x43, 1, 0x71 }, { 0x5d, 1, 0x71 }, { 0x02, 5, 0x71 },
+		{ 0x55, 1, 0x76 }, { 0x43, 1, 0x76 }, { 0x5d, 1, 0x76 }, { 0x02, 5, 0x76 },
+	},
+	[0x89] = {
+		{ 0x56, 1, 0x6a }, { 0x82, 1, 0x6a }, { 0x44, 1, 0x6a }, { 0x52, 1, 0x6a },
+		{ 0x63, 1, 0x6a }, { 0x5e, 1, 0x6a }, { 0x68, 1, 0x6a }, { 0x03, 5, 0x6a },
+		{ 0x56, 1, 0x6b }, { 0x82, 1, 0x6b }, { 0x44, 1, 0x6b }, { 0x52, 1, 0x6b },
+		{ 0x63, 1, 0x6b }, { 0x5e, 1, 0x6b }, { 0x68, 1, 0x6b }, { 0x03, 5, 0x6b },
+	},
+	[0x8a] = {
+		{ 0x55, 1, 0x6c }, { 0x43, 1, 0x6c }, { 0x5d, 1, 0x6c }, { 0x02, 5, 0x6c },
+		{ 0x55, 1, 0x6d }, { 0x43, 1, 0x6d }, { 0x5d, 1, 0x6d }, { 0x02, 5, 0x6d },
+		{ 0x55, 1, 0x6e }, { 0x43, 1, 0x6e }, { 0x5d, 1, 0x6e }, { 0x02, 5, 0x6e },
+		{ 0x55, 1, 0x70 }, { 0x43, 1, 0x70 }, { 0x5d, 1, 0x70 }, { 0x02, 5, 0x70 },
+	},
+	[0x8b] = {
+		{ 0x56, 1, 0x6c }, { 0x82, 1, 0x6c }, { 0x44, 1, 0x6c }, { 0x52, 1, 0x6c },
+		{ 0x63, 1, 0x6c }, { 0x5e, 1, 0x6c }, { 0x68, 1, 0x6c }, { 0x03, 5, 0x6c },
+		{ 0x56, 1, 0x6d }, { 0x82, 1, 0x6d }, { 0x44, 1, 0x6d }, { 0x52, 1, 0x6d },
+		{ 0x63, 1, 0x6d }, { 0x5e, 1, 0x6d }, { 0x68, 1, 0x6d }, { 0x03, 5, 0x6d },
+	},
+	[0x8c] = {
+		{ 0x56, 1, 0x6e }, { 0x82, 1, 0x6e }, { 0x44, 1, 0x6e }, { 0x52, 1, 0x6e },
+		{ 0x63, 1, 0x6e }, { 0x5e, 1, 0x6e }, { 0x68, 1, 0x6e }, { 0x03, 5, 0x6e },
+		{ 0x56, 1, 0x70 }, { 0x82, 1, 0x70 }, { 0x44, 1, 0x70 }, { 0x52, 1, 0x70 },
+		{ 0x63, 1, 0x70 }, { 0x5e, 1, 0x70 }, { 0x68, 1, 0x70 }, { 0x03, 5, 0x70 },
+	},
+	[0x8d] = {
+		{ 0x56, 1, 0x71 }, { 0x82, 1, 0x71 }, { 0x44, 1, 0x71 }, { 0x52, 1, 0x71 },
+		{ 0x63, 1, 0x71 }, { 0x5e, 1, 0x71 }, { 0x68, 1, 0x71 }, { 0x03, 5, 0x71 },
+		{ 0x56, 1, 0x76 }, { 0x82, 1, 0x76 }, { 0x44, 1, 0x76 }, { 0x52, 1, 0x76 },
+		{ 0x63, 1, 0x76 }, { 0x5e, 1, 0x76 }, { 0x68, 1, 0x76 }, { 0x03, 5, 0x76 },
+	},
+	[0x8e] = {
+		{ 0x56, 1, 0x72 }, { 0x82, 1, 0x72 }, { 0x44, 1, 0x72 }, { 0x52, 1, 0x72 },
+		{ 0x63, 1, 0x72 }, { 0x5e, 1, 0x72 }, { 0x68, 1, 0x72 }, { 0x03, 5, 0x72 },
+		{ 0x56, 1, 0x75 }, { 0x82, 1, 0x75 }, { 0x44, 1, 0x75 }, { 0x52, 1, 0x75 },
+		{ 0x63, 1, 0x75 }, { 0x5e, 1, 0x75 }, { 0x68, 1, 0x75 }, { 0x03, 5, 0x75 },
+	},
+	[0x8f] = {
+		{ 0x56, 1, 0x73 }, { 0x82, 1, 0x73 }, { 0x44, 1, 0x73 }, { 0x52, 1, 0x73 },
+		{ 0x63, 1, 0x73 }, { 0x5e, 1, 0x73 }, { 0x68, 1, 0x73 }, { 0x03, 5, 0x73 },
+		{ 0x56, 1, 0x74 }, { 0x82, 1, 0x74 }, { 0x44, 1, 0x74 }, { 0x52, 1, 0x74 },
+		{ 0x63, 1, 0x74 }, { 0x5e, 1, 0x74 }, { 0x68, 1, 0x74 }, { 0x03, 5, 0x74 },
+	},
+	[0x90] = {
+		{ 0x55, 1, 0x77 }, { 0x43, 1, 0x77 }, { 0x5d, 1, 0x77 }, { 0x02, 5, 0x77 },
+		{ 0x55, 1, 0x78 }, { 0x43, 1, 0x78 }, { 0x5d, 1, 0x78 }, { 0x02, 5, 0x78 },
+		{ 0x55, 1, 0x79 }, { 0x43, 1, 0x79 }, { 0x5d, 1, 0x79 }, { 0x02, 5, 0x79 },
+		{ 0x55, 1, 0x7a }, { 0x43, 1, 0x7a }, { 0x5d, 1, 0x7a }, { 0x02, 5, 0x7a },
+	},
+	[0x91] = {
+		{ 0x56, 1, 0x77 }, { 0x82, 1, 0x77 }, { 0x44, 1, 0x77 }, { 0x52, 1, 0x77 },
+		{ 0x63, 1, 0x77 }, { 0x5e, 1, 0x77 }, { 0x68, 1, 0x77 }, { 0x03, 5, 0x77 },
+		{ 0x56, 1, 0x78 }, { 0x82, 1, 0x78 }, { 0x44, 1, 0x78 }, { 0x52, 1, 0x78 },
+		{ 0x63, 1, 0x78 }, { 0x5e, 1, 0x78 }, { 0x68, 1, 0x78 }, { 0x03, 5, 0x78 },
+	},
+	[0x92] = {
+		{ 0x56, 1, 0x79 }, { 0x82, 1, 0x79 }, { 0x44, 1, 0x79 }, { 0x52, 1, 0x79 },
+		{ 0x63, 1, 0x79 }, { 0x5e, 1, 0x79 }, { 0x68, 1, 0x79 }, { 0x03, 5, 0x79 },
+		{ 0x56, 1, 0x7a }, { 0x82, 1, 0x7a }, { 0x44, 1, 0x7a }, { 0x52, 1, 0x7a },
+		{ 0x63, 1, 0x7a }, { 0x5e, 1, 0x7a }, { 0x68, 1, 0x7a }, { 0x03, 5, 0x7a },
+	},
+	[0x93] = {
+		{ 0x56, 1, 0x7f }, { 0x82, 1, 0x7f }, { 0x44, 1, 0x7f }, { 0x52, 1, 0x7f },
+		{ 0x63, 1, 0x7f }, { 0x5e, 1, 0x7f }, { 0x68, 1, 0x7f }, { 0x03, 5, 0x7f },
+		{ 0x56, 1, 0xdc }, { 0x82, 1, 0xdc }, { 0x44, 1, 0xdc }, { 0x52, 1, 0xdc },
+		{ 0x63, 1, 0xdc }, { 0x5e, 1, 0xdc }, { 0x68, 1, 0xdc }, { 0x03, 5, 0xdc },
+	},
+	[0x94] = {
+		{ 0x56, 1, 0xd0 }, { 0x82, 1, 0xd0 }, { 0x44, 1, 0xd0 }, { 0x52, 1, 0xd0 },
+		{ 0x63, 1, 0xd0 }, { 0x5e, 1, 0xd0 }, { 0x68, 1, 0xd0 }, { 0x03, 5, 0xd0 },
+		{ 0x55, 1, 0x80 }, { 0x43, 1, 0x80 }, { 0x5d, 1, 0x80 }, { 0x02, 5, 0x80 },
+		{ 0x55, 1, 0x82 }, { 0x43, 1, 0x82 }, { 0x5d, 1, 0x82 }, { 0x02, 5, 0x82 },
+	},
+	[0x95] = {
+		{ 0x56, 1, 0x80 }, { 0x82, 1, 0x80 }, { 0x44, 1, 0x80 }, { 0x52, 1, 0x80 },
+		{ 0x63, 1, 0x80 }, { 0x5e, 1, 0x80 }, { 0x68, 1, 0x80 }, { 0x03, 5, 0x80 },
+		{ 0x56, 1, 0x82 }, { 0x82, 1, 0x82 }, { 0x44, 1, 0x82 }, { 0x52, 1, 0x82 },
+		{ 0x63, 1, 0x82 }, { 0x5e, 1, 0x82 }, { 0x68, 1, 0x82 }, { 0x03, 5, 0x82 },
+	},
+	[0x96] = {
+		{ 0x00, 5, 0xb0 }, { 0x00, 5, 0xb1 }, { 0x00, 5, 0xb3 }, { 0x00, 5, 0xd1 },
+		{ 0x00, 5, 0xd8 }, { 0x00, 5, 0xd9 }, { 0x00, 5, 0xe3 }, { 0x00, 5, 0xe5 },
+		{ 0x00, 5, 0xe6 }, { 0x9a, 0, 0x00 }, { 0x9f, 0, 0x00 }, { 0xa0, 0, 0x00 },
+		{ 0xb4, 0, 0x00 }, { 0xb6, 0, 0x00 }, { 0xb8, 0, 0x00 }, { 0xbe, 0, 0x00 },
+	},
+	[0x97] = {
+		{ 0x42, 1, 0xe6 }, { 0x01, 5, 0xe6 }, { 0x00, 5, 0x81 }, { 0x00, 5, 0x84 },
+		{ 0x00, 5, 0x85 }, { 0x00, 5, 0x86 }, { 0x00, 5, 0x88 }, { 0x00, 5, 0x92 },
+		{ 0x00, 5, 0x9a }, { 0x00, 5, 0x9c }, { 0x00, 5, 0xa0 }, { 0x00, 5, 0xa3 },
+		{ 0x00, 5, 0xa4 }, { 0x00, 5, 0xa9 }, { 0x00, 5, 0xaa }, { 0x00, 5, 0xad },
+	},
+	[0x98] = {
+		{ 0x55, 1, 0xe6 }, { 0x43, 1, 0xe6 }, { 0x5d, 1, 0xe6 }, { 0x02, 5, 0xe6 },
+		{ 0x42, 1, 0x81 }, { 0x01, 5, 0x81 }, { 0x42, 1, 0x84 }, { 0x01, 5, 0x84 },
+		{ 0x42, 1, 0x85 }, { 0x01, 5, 0x85 }, { 0x42, 1, 0x86 }, { 0x01, 5, 0x86 },
+		{ 0x42, 1, 0x88 }, { 0x01, 5, 0x88 }, { 0x42, 1, 0x92 }, { 0x01, 5, 0x92 },
+	},
+	[0x99] = {
+		{ 0x56, 1, 0xe6 }, { 0x82, 1, 0xe6 }, { 0x44, 1, 0xe6 }, { 0x52, 1, 0xe6 },
+		{ 0x63, 1, 0xe6 }, { 0x5e, 1, 0xe6 }, { 0x68, 1, 0xe6 }, { 0x03, 5, 0xe6 },
+		{ 0x55, 1, 0x81 }, { 0x43, 1, 0x81 }, { 0x5d, 1, 0x81 }, { 0x02, 5, 0x81 },
+		{ 0x55, 1, 0x84 }, { 0x43, 1, 0x84 }, { 0x5d, 1, 0x84 }, { 0x02, 5, 0x84 },
+	},
+	[0x9a] = {
+		{ 0x56, 1, 0x81 }, { 0x82, 1, 0x81 }, { 0x44, 1, 0x81 }, { 0x52, 1, 0x81 },
+		{ 0x63, 1, 0x81 }, { 0x5e, 1, 0x81 }, { 0x68, 1, 0x81 }, { 0x03, 5, 0x81 },
+		{ 0x56, 1, 0x84 }, { 0x82, 1, 0x84 }, { 0x44, 1, 0x84 }, { 0x52, 1, 0x84 },
+		{ 0x63, 1, 0x84 }, { 0x5e, 1, 0x84 }, { 0x68, 1, 0x84 }, { 0x03, 5, 0x84 },
+	},
+	[0x9b] = {
+		{ 0x42, 1, 0x83 }, { 0x01, 5, 0x83 }, { 0x42, 1, 0xa2 }, { 0x01, 5, 0xa2 },
+		{ 0x42, 1, 0xb8 }, { 0x01, 5, 0xb8 }, { 0x42, 1, 0xc2 }, { 0x01, 5, 0xc2 },
+		{ 0x42, 1, 0xe0 }, { 0x01, 5, 0xe0 }, { 0x42, 1, 0xe2 }, { 0x01, 5, 0xe2 },
+		{ 0x00, 5, 0x99 }, { 0x00, 5, 0xa1 }, { 0x00, 5, 0xa7 }, { 0x00, 5, 0xac },
+	},
+	[0x9c] = {
+		{ 0x55, 1, 0x83 }, { 0x43, 1, 0x83 }, { 0x5d, 1, 0x83 }, { 0x02, 5, 0x83 },
+		{ 0x55, 1, 0xa2 }, { 0x43, 1, 0xa2 }, { 0x5d, 1, 0xa2 }, { 0x02, 5, 0xa2 },
+		{ 0x55, 1, 0xb8 }, { 0x43, 1, 0xb8 }, { 0x5d, 1, 0xb8 }, { 0x02, 5, 0xb8 },
+		{ 0x55, 1, 0xc2 }, { 0x43, 1, 0xc2 }, { 0x5d, 1, 0xc2 }, { 0x02, 5, 0xc2 },
+	},
+	[0x9d] = {
+		{ 0x56, 1, 0x83 }, { 0x82, 1, 0x83 }, { 0x44, 1, 0x83 }, { 0x52, 1, 0x83 },
+		{ 0x63, 1, 0x83 }, { 0x5e, 1, 0x83 }, { 0x68, 1, 0x83 }, { 0x03, 5, 0x83 },
+		{ 0x56, 1, 0xa2 }, { 0x82, 1, 0xa2 }, { 0x44, 1, 0xa2 }, { 0x52, 1, 0xa2 },
+		{ 0x63, 1, 0xa2 }, { 0x5e, 1, 0xa2 }, { 0x68, 1, 0xa2 }, { 0x03, 5, 0xa2 },
+	},
+	[0x9e] = {
+		{ 0x55, 1, 0x85 }, { 0x43, 1, 0x85 }, { 0x5d, 1, 0x85 }, { 0x02, 5, 0x85 },
+		{ 0x55, 1, 0x86 }, { 0x43, 1, 0x86 }, { 0x5d, 1, 0x86 }, { 0x02, 5, 0x86 },
+		{ 0x55, 1, 0x88 }, { 0x43, 1, 0x88 }, { 0x5d, 1, 0x88 }, { 0x02, 5, 0x88 },
+		{ 0x55, 1, 0x92 }, { 0x43, 1, 0x92 }, { 0x5d, 1, 0x92 }, { 0x02, 5, 0x92 },
+	},
+	[0x9f] = {
+		{ 0x56, 1, 0x85 }, { 0x82, 1, 0x85 }, { 0x44, 1, 0x85 }, { 0x52, 1, 0x85 },
+		{ 0x63, 1, 0x85 }, { 0x5e, 1, 0x85 }, { 0x68, 1, 0x85 }, { 0x03, 5, 0x85 },
+		{ 0x56, 1, 0x86 }, { 0x82, 1, 0x86 }, { 0x44, 1, 0x86 }, { 0x52, 1, 0x86 },
+		{ 0x63, 1, 0x86 }, { 0x5e, 1, 0x86 }, { 0x68, 1, 0x86 }, { 0x03, 5, 0x86 },
+	},
+	[0xa0] = {
+		{ 0x56, 1, 0x88 }, { 0x82, 1, 0x88 }, { 0x44, 1, 0x88 }, { 0x52, 1, 0x88 },
+		{ 0x63, 1, 0x88 }, { 0x5e, 1, 0x88 }, { 0x68, 1, 0x88 }, { 0x03, 5, 0x88 },
+		{ 0x56, 1, 0x92 }, { 0x82, 1, 0x92 }, { 0x44, 1, 0x92 }, { 0x52, 1, 0x92 },
+		{ 0x63, 1, 0x92 }, { 0x5e, 1, 0x92 }, { 0x68, 1, 0x92 }, { 0x03, 5, 0x92 },
+	},
+	[0xa1] = {
+		{ 0x56, 1, 0x89 }, { 0x82, 1, 0x89 }, { 0x44, 1, 0x89 }, { 0x52, 1, 0x89 },
+		{ 0x63, 1, 0x89 }, { 0x5e, 1, 0x89 }, { 0x68, 1, 0x89 }, { 0x03, 5, 0x89 },
+		{ 0x56, 1, 0x8a }, { 0x82, 1, 0x8a }, { 0x44, 1, 0x8a }, { 0x52, 1, 0x8a },
+		{ 0x63, 1, 0x8a }, { 0x5e, 1, 0x8a }, { 0x68, 1, 0x8a }, { 0x03, 5, 0x8a },
+	},
+	[0xa2] = {
+		{ 0x55, 1, 0x8b }, { 0x43, 1, 0x8b }, { 0x5d, 1, 0x8b }, { 0x02, 5, 0x8b },
+		{ 0x55, 1, 0x8c }, { 0x43, 1, 0x8c }, { 0x5d, 1, 0x8c }, { 0x02, 5, 0x8c },
+		{ 0x55, 1, 0x8d }, { 0x43, 1, 0x8d }, { 0x5d, 1, 0x8d }, { 0x02, 5, 0x8d },
+		{ 0x55, 1, 0x8f }, { 0x43, 1, 0x8f }, { 0x5d, 1, 0x8f }, { 0x02, 5, 0x8f },
+	},
+	[0xa3] = {
+		{ 0x56, 1, 0x8b }, { 0x82, 1, 0x8b }, { 0x44, 1, 0x8b }, { 0x52, 1, 0x8b },
+		{ 0x63, 1, 0x8b }, { 0x5e, 1, 0x8b }, { 0x68, 1, 0x8b }, { 0x03, 5, 0x8b },
+		{ 0x56, 1, 0x8c }, { 0x82, 1, 0x8c }, { 0x44, 1, 0x8c }, { 0x52, 1, 0x8c },
+		{ 0x63, 1, 0x8c }, { 0x5e, 1, 0x8c }, { 0x68, 1, 0x8c }, { 0x03, 5, 0x8c },
+	},
+	[0xa4] = {
+		{ 0x56, 1, 0x8d }, { 0x82, 1, 0x8d }, { 0x44, 1, 0x8d }, { 0x52, 1, 0x8d },
+		{ 0x63, 1, 0x8d }, { 0x5e, 1, 0x8d }, { 0x68, 1, 0x8d }, { 0x03, 5, 0x8d },
+		{ 0x56, 1, 0x8f }, { 0x82, 1, 0x8f }, { 0x44, 1, 0x8f }, { 0x52, 1, 0x8f },
+		{ 0x63, 1, 0x8f }, { 0x5e, 1, 0x8f }, { 0x68, 1, 0x8f }, { 0x03, 5, 0x8f },
+	},
+	[0xa5] = {
+		{ 0x55, 1, 0x90 }, { 0x43, 1, 0x90 }, { 0x5d, 1, 0x90 }, { 0x02, 5, 0x90 },
+		{ 0x55, 1, 0x91 }, { 0x43, 1, 0x91 }, { 0x5d, 1, 0x91 }, { 0x02, 5, 0x91 },
+		{ 0x55, 1, 0x94 }, { 0x43, 1, 0x94 }, { 0x5d, 1, 0x94 }, { 0x02, 5, 0x94 },
+		{ 0x55, 1, 0x9f }, { 0x43, 1, 0x9f }, { 0x5d, 1, 0x9f }, { 0x02, 5, 0x9f },
+	},
+	[0xa6] = {
+		{ 0x56, 1, 0x90 }, { 0x82, 1, 0x90 }, { 0x44, 1, 0x90 }, { 0x52, 1, 0x90 },
+		{ 0x63, 1, 0x90 }, { 0x5e, 1, 0x90 }, { 0x68, 1, 0x90 }, { 0x03, 5, 0x90 },
+		{ 0x56, 1, 0x91 }, { 0x82, 1, 0x91 }, { 0x44, 1, 0x91 }, { 0x52, 1, 0x91 },
+		{ 0x63, 1, 0x91 }, { 0x5e, 1, 0x91 }, { 0x68, 1, 0x91 }, { 0x03, 5, 0x91 },
+	},
+	[0xa7] = {
+		{ 0x00, 5, 0x93 }, { 0x00, 5, 0x95 }, { 0x00, 5, 0x96 }, { 0x00, 5, 0x97 },
+		{ 0x00, 5, 0x98 }, { 0x00, 5, 0x9b }, { 0x00, 5, 0x9d }, { 0x00, 5, 0x9e },
+		{ 0x00, 5, 0xa5 }, { 0x00, 5, 0xa6 }, { 0x00, 5, 0xa8 }, { 0x00, 5, 0xae },
+		{ 0x00, 5, 0xaf }, { 0x00, 5, 0xb4 }, { 0x00, 5, 0xb6 }, { 0x00, 5, 0xb7 },
+	},
+	[0xa8] = {
+		{ 0x42, 1, 0x93 }, { 0x01, 5, 0x93 }, { 0x42, 1, 0x95 }, { 0x01, 5, 0x95 },
+		{ 0x42, 1, 0x96 }, { 0x01, 5, 0x96 }, { 0x42, 1, 0x97 }, { 0x01, 5, 0x97 },
+		{ 0x42, 1, 0x98 }, { 0x01, 5, 0x98 }, { 0x42, 1, 0x9b }, { 0x01, 5, 0x9b },
+		{ 0x42, 1, 0x9d }, { 0x01, 5, 0x9d }, { 0x42, 1, 0x9e }, { 0x01, 5, 0x9e },
+	},
+	[0xa9] = {
+		{ 0x55, 1, 0x93 }, { 0x43, 1, 0x93 }, { 0x5d, 1, 0x93 }, { 0x02, 5, 0x93 },
+		{ 0x55, 1, 0x95 }, { 0x43, 1, 0x95 }, { 0x5d, 1, 0x95 }, { 0x02, 5, 0x95 },
+		{ 0x55, 1, 0x96 }, { 0x43, 1, 0x96 }, { 0x5d, 1, 0x96 }, { 0x02, 5, 0x96 },
+		{ 0x55, 1, 0x97 }, { 0x43, 1, 0x97 }, { 0x5d, 1, 0x97 }, { 0x02, 5, 0x97 },
+	},
+	[0xaa] = {
+		{ 0x56, 1, 0x93 }, { 0x82, 1, 0x93 }, { 0x44, 1, 0x93 }, { 0x52, 1, 0x93 },
+		{ 0x63, 1, 0x93 }, { 0x5e, 1, 0x93 }, { 0x68, 1, 0x93 }, { 0x03, 5, 0x93 },
+		{ 0x56, 1, 0x95 }, { 0x82, 1, 0x95 }, { 0x44, 1, 0x95 }, { 0x52, 1, 0x95 },
+		{ 0x63, 1, 0x95 }, { 0x5e, 1, 0x95 }, { 0x68, 1, 0x95 }, { 0x03, 5, 0x95 },
+	},
+	[0xab] = {
+		{ 0x56, 1, 0x94 }, { 0x82, 1, 0x94 }, { 0x44, 1, 0x94 }, { 0x52, 1, 0x94 },
+		{ 0x63, 1, 0x94 }, { 0x5e, 1, 0x94 }, { 0x68, 1, 0x94 }, { 0x03, 5, 0x94 },
+		{ 0x56, 1, 0x9f }, { 0x82, 1, 0x9f }, { 0x44, 1, 0x9f }, { 0x52, 1, 0x9f },
+		{ 0x63, 1, 0x9f }, { 0x5e, 1, 0x9f }, { 0x68, 1, 0x9f }, { 0x03, 5, 0x9f },
+	},
+	[0xac] = {
+		{ 0x56, 1, 0x96 }, { 0x82, 1, 0x96 }, { 0x44, 1, 0x96 }, { 0x52, 1, 0x96 },
+		{ 0x63, 1, 0x96 }, { 0x5e, 1, 0x96 }, { 0x68, 1, 0x96 }, { 0x03, 5, 0x96 },
+		{ 0x56, 1, 0x97 }, { 0x82, 1, 0x97 }, { 0x44, 1, 0x97 }, { 0x52, 1, 0x97 },
+		{ 0x63, 1, 0x97 }, { 0x5e, 1, 0x97 }, { 0x68, 1, 0x97 }, { 0x03, 5, 0x97 },
+	},
+	[0xad] = {
+		{ 0x55, 1, 0x98 }, { 0x43, 1, 0x98 }, { 0x5d, 1, 0x98 }, { 0x02, 5, 0x98 },
+		{ 0x55, 1, 0x9b }, { 0x43, 1, 0x9b }, { 0x5d, 1, 0x9b }, { 0x02, 5, 0x9b },
+		{ 0x55, 1, 0x9d }, { 0x43, 1, 0x9d }, { 0x5d, 1, 0x9d }, { 0x02, 5, 0x9d },
+		{ 0x55, 1, 0x9e }, { 0x43, 1, 0x9e }, { 0x5d, 1, 0x9e }, { 0x02, 5, 0x9e },
+	},
+	[0xae] = {
+		{ 0x56, 1, 0x98 }, { 0x82, 1, 0x98 }, { 0x44, 1, 0x98 }, { 0x52, 1, 0x98 },
+		{ 0x63, 1, 0x98 }, { 0x5e, 1, 0x98 }, { 0x68, 1, 0x98 }, { 0x03, 5, 0x98 },
+		{ 0x56, 1, 0x9b }, { 0x82, 1, 0x9b }, { 0x44, 1, 0x9b }, { 0x52, 1, 0x9b },
+		{ 0x63, 1, 0x9b }, { 0x5e, 1, 0x9b }, { 0x68, 1, 0x9b }, { 0x03, 5, 0x9b },
+	},
+	[0xaf] = {
+		{ 0x55, 1, 0xe0 }, { 0x43, 1, 0xe0 }, { 0x5d, 1, 0xe0 }, { 0x02, 5, 0xe0 },
+		{ 0x55, 1, 0xe2 }, { 0x43, 1, 0xe2 }, { 0x5d, 1, 0xe2 }, { 0x02, 5, 0xe2 },
+		{ 0x42, 1, 0x99 }, { 0x01, 5, 0x99 }, { 0x42, 1, 0xa1 }, { 0x01, 5, 0xa1 },
+		{ 0x42, 1, 0xa7 }, { 0x01, 5, 0xa7 }, { 0x42, 1, 0xac }, { 0x01, 5, 0xac },
+	},
+	[0xb0] = {
+		{ 0x55, 1, 0x99 }, { 0x43, 1, 0x99 }, { 0x5d, 1, 0x99 }, { 0x02, 5, 0x99 },
+		{ 0x55, 1, 0xa1 }, { 0x43, 1, 0xa1 }, { 0x5d, 1, 0xa1 }, { 0x02, 5, 0xa1 },
+		{ 0x55, 1, 0xa7 }, { 0x43, 1, 0xa7 }, { 0x5d, 1, 0xa7 }, { 0x02, 5, 0xa7 },
+		{ 0x55, 1, 0xac }, { 0x43, 1, 0xac }, { 0x5d, 1, 0xac }, { 0x02, 5, 0xac },
+	},
+	[0xb1] = {
+		{ 0x56, 1, 0x99 }, { 0x82, 1, 0x99 }, { 0x44, 1, 0x99 }, { 0x52, 1, 0x99 },
+		{ 0x63, 1, 0x99 }, { 0x5e, 1, 0x99 }, { 0x68, 1, 0x99 }, { 0x03, 5, 0x99 },
+		{ 0x56, 1, 0xa1 }, { 0x82, 1, 0xa1 }, { 0x44, 1, 0xa1 }, { 0x52, 1, 0xa1 },
+		{ 0x63, 1, 0xa1 }, { 0x5e, 1, 0xa1 }, { 0x68, 1, 0xa1 }, { 0x03, 5, 0xa1 },
+	},
+	[0xb2] = {
+		{ 0x42, 1, 0x9a }, { 0x01, 5, 0x9a }, { 0x42, 1, 0x9c }, { 0x01, 5, 0x9c },
+		{ 0x42, 1, 0xa0 }, { 0x01, 5, 0xa0 }, { 0x42, 1, 0xa3 }, { 0x01, 5, 0xa3 },
+		{ 0x42, 1, 0xa4 }, { 0x01, 5, 0xa4 }, { 0x42, 1, 0xa9 }, { 0x01, 5, 0xa9 },
+		{ 0x42, 1, 0xaa }, { 0x01, 5, 0xaa }, { 0x42, 1, 0xad }, { 0x01, 5, 0xad },
+	},
+	[0xb3] = {
+		{ 0x55, 1, 0x9a }, { 0x43, 1, 0x9a }, { 0x5d, 1, 0x9a }, { 0x02, 5, 0x9a },
+		{ 0x55, 1, 0x9c }, { 0x43, 1, 0x9c }, { 0x5d, 1, 0x9c }, { 0x02, 5, 0x9c },
+		{ 0x55, 1, 0xa0 }, { 0x43, 1, 0xa0 }, { 0x5d, 1, 0xa0 }, { 0x02, 5, 0xa0 },
+		{ 0x55, 1, 0xa3 }, { 0x43, 1, 0xa3 }, { 0x5d, 1, 0xa3 }, { 0x02, 5, 0xa3 },
+	},
+	[0xb4] = {
+		{ 0x56, 1, 0x9a }, { 0x82, 1, 0x9a }, { 0x44, 1, 0x9a }, { 0x52, 1, 0x9a },
+		{ 0x63, 1, 0x9a }, { 0x5e, 1, 0x9a }, { 0x68, 1, 0x9a }, { 0x03, 5, 0x9a },
+		{ 0x56, 1, 0x9c }, { 0x82, 1, 0x9c }, { 0x44, 1, 0x9c }, { 0x52, 1, 0x9c },
+		{ 0x63, 1, 0x9c }, { 0x5e, 1, 0x9c }, { 0x68, 1, 0x9c }, { 0x03, 5, 0x9c },
+	},
+	[0xb5] = {
+		{ 0x56, 1, 0x9d }, { 0x82, 1, 0x9d }, { 0x44, 1, 0x9d }, { 0x52, 1, 0x9d },
+		{ 0x63, 1, 0x9d }, { 0x5e, 1, 0x9d }, { 0x68, 1, 0x9d }, { 0x03, 5, 0x9d },
+		{ 0x56, 1, 0x9e }, { 0x82, 1, 0x9e }, { 0x44, 1, 0x9e }, { 0x52, 1, 0x9e },
+		{ 0x63, 1, 0x9e }, { 0x5e, 1, 0x9e }, { 0x68, 1, 0x9e }, { 0x03, 5, 0x9e },
+	},
+	[0xb6] = {
+		{ 0x56, 1, 0xa0 }, { 0x82, 1, 0xa0 }, { 0x44, 1, 0xa0 }, { 0x52, 1, 0xa0 },
+		{ 0x63, 1, 0xa0 }, { 0x5e, 1, 0xa0 }, { 0x68, 1, 0xa0 }, { 0x03, 5, 0xa0 },
+		{ 0x56, 1, 0xa3 }, { 0x82, 1, 0xa3 }, { 0x44, 1, 0xa3 }, { 0x52, 1, 0xa3 },
+		{ 0x63, 1, 0xa3 }, { 0x5e, 1, 0xa3 }, { 0x68, 1, 0xa3 }, { 0x03, 5, 0xa3 },
+	},
+	[0xb7] = {
+		{ 0x55, 1, 0xa4 }, { 0x43, 1, 0xa4 }, { 0x5d, 1, 0xa4 }, { 0x02, 5, 0xa4 },
+		{ 0x55, 1, 0xa9 }, { 0x43, 1, 0xa9 }, { 0x5d, 1, 0xa9 }, { 0x02, 5, 0xa9 },
+		{ 0x55, 1, 0xaa }, { 0x43, 1, 0xaa }, { 0x5d, 1, 0xaa }, { 0x02, 5, 0xaa },
+		{ 0x55, 1, 0xad }, { 0x43, 1, 0xad }, { 0x5d, 1, 0xad }, { 0x02, 5, 0xad },
+	},
+	[0xb8] = {
+		{ 0x56, 1, 0xa4 }, { 0x82, 1, 0xa4 }, { 0x44, 1, 0xa4 }, { 0x52, 1, 0xa4 },
+		{ 0x63, 1, 0xa4 }, { 0x5e, 1, 0xa4 }, { 0x68, 1, 0xa4 }, { 0x03, 5, 0xa4 },
+		{ 0x56, 1, 0xa9 }, { 0x82, 1, 0xa9 }, { 0x44, 1, 0xa9 }, { 0x52, 1, 0xa9 },
+		{ 0x63, 1, 0xa9 }, { 0x5e, 1, 0xa9 }, { 0x68, 1, 0xa9 }, { 0x03, 5, 0xa9 },
+	},
+	[0xb9] = {
+		{ 0x42, 1, 0xa5 }, { 0x01, 5, 0xa5 }, { 0x42, 1, 0xa6 }, { 0x01, 5, 0xa6 },
+		{ 0x42, 1, 0xa8 }, { 0x01, 5, 0xa8 }, { 0x42, 1, 0xae }, { 0x01, 5, 0xae },
+		{ 0x42, 1, 0xaf }, { 0x01, 5, 0xaf }, { 0x42, 1, 0xb4 }, { 0x01, 5, 0xb4 },
+		{ 0x42, 1, 0xb6 }, { 0x01, 5, 0xb6 }, { 0x42, 1, 0xb7 }, { 0x01, 5, 0xb7 },
+	},
+	[0xba] = {
+		{ 0x55, 1, 0xa5 }, { 0x43, 1, 0xa5 }, { 0x5d, 1, 0xa5 }, { 0x02, 5, 0xa5 },
+		{ 0x55, 1, 0xa6 }, { 0x43, 1, 0xa6 }, { 0x5d, 1, 0xa6 }, { 0x02, 5, 0xa6 },
+		{ 0x55, 1, 0xa8 }, { 0x43, 1, 0xa8 }, { 0x5d, 1, 0xa8 }, { 0x02, 5, 0xa8 },
+		{ 0x55, 1, 0xae }, { 0x43, 1, 0xae }, { 0x5d, 1, 0xae }, { 0x02, 5, 0xae },
+	},
+	[0xbb] = {
+		{ 0x56, 1, 0xa5 }, { 0x82, 1, 0xa5 }, { 0x44, 1, 0xa5 }, { 0x52, 1, 0xa5 },
+		{ 0x63, 1, 0xa5 }, { 0x5e, 1, 0xa5 }, { 0x68, 1, 0xa5 }, { 0x03, 5, 0xa5 },
+		{ 0x56, 1, 0xa6 }, { 0x82, 1, 0xa6 }, { 0x44, 1, 0xa6 }, { 0x52, 1, 0xa6 },
+		{ 0x63, 1, 0xa6 }, { 0x5e, 1, 0xa6 }, { 0x68, 1, 0xa6 }, { 0x03, 5, 0xa6 },
+	},
+	[0xbc] = {
+		{ 0x56, 1, 0xa7 }, { 0x82, 1, 0xa7 }, { 0x44, 1, 0xa7 }, { 0x52, 1, 0xa7 },
+		{ 0x63, 1, 0xa7 }, { 0x5e, 1, 0xa7 }, { 0x68, 1, 0xa7 }, { 0x03, 5, 0xa7 },
+		{ 0x56, 1, 0xac }, { 0x82, 1, 0xac }, { 0x44, 1, 0xac }, { 0x52, 1, 0xac },
+		{ 0x63, 1, 0xac }, { 0x5e, 1, 0xac }, { 0x68, 1, 0xac }, { 0x03, 5, 0xac },
+	},
+	[0xbd] = {
+		{ 0x56, 1, 0xa8 }, { 0x82, 1, 0xa8 }, { 0x44, 1, 0xa8 }, { 0x52, 1, 0xa8 },
+		{ 0x63, 1, 0xa8 }, { 0x5e, 1, 0xa8 }, { 0x68, 1, 0xa8 }, { 0x03, 5, 0xa8 },
+		{ 0x56, 1, 0xae }, { 0x82, 1, 0xae }, { 0x44, 1, 0xae }, { 0x52, 1, 0xae },
+		{ 0x63, 1, 0xae }, { 0x5e, 1, 0xae }, { 0x68, 1, 0xae }, { 0x03, 5, 0xae },
+	},
+	[0xbe] = {
+		{ 0x56, 1, 0xaa }, { 0x82, 1, 0xaa }, { 0x44, 1, 0xaa }, { 0x52, 1, 0xaa },
+		{ 0x63, 1, 0xaa }, { 0x5e, 1, 0xaa }, { 0x68, 1, 0xaa }, { 0x03, 5, 0xaa },
+		{ 0x56, 1, 0xad }, { 0x82, 1, 0xad }, { 0x44, 1, 0xad }, { 0x52, 1, 0xad },
+		{ 0x63, 1, 0xad }, { 0x5e, 1, 0xad }, { 0x68, 1, 0xad }, { 0x03, 5, 0xad },
+	},
+	[0xbf] = {
+		{ 0x42, 1, 0xab }, { 0x01, 5, 0xab }, { 0x42, 1, 0xce }, { 0x01, 5, 0xce },
+		{ 0x42, 1, 0xd7 }, { 0x01, 5, 0xd7 }, { 0x42, 1, 0xe1 }, { 0x01, 5, 0xe1 },
+		{ 0x42, 1, 0xec }, { 0x01, 5, 0xec }, { 0x42, 1, 0xed }, { 0x01, 5, 0xed },
+		{ 0x00, 5, 0xc7 }, { 0x00, 5, 0xcf }, { 0x00, 5, 0xea }, { 0x00, 5, 0xeb },
+	},
+	[0xc0] = {
+		{ 0x55, 1, 0xab }, { 0x43, 1, 0xab }, { 0x5d, 1, 0xab }, { 0x02, 5, 0xab },
+		{ 0x55, 1, 0xce }, { 0x43, 1, 0xce }, { 0x5d, 1, 0xce }, { 0x02, 5, 0xce },
+		{ 0x55, 1, 0xd7 }, { 0x43, 1, 0xd7 }, { 0x5d, 1, 0xd7 }, { 0x02, 5, 0xd7 },
+		{ 0x55, 1, 0xe1 }, { 0x43, 1, 0xe1 }, { 0x5d, 1, 0xe1 }, { 0x02, 5, 0xe1 },
+	},
+	[0xc1] = {
+		{ 0x56, 1, 0xab }, { 0x82, 1, 0xab }, { 0x44, 1, 0xab }, { 0x52, 1, 0xab },
+		{ 0x63, 1, 0xab }, { 0x5e, 1, 0xab }, { 0x68, 1, 0xab }, { 0x03, 5, 0xab },
+		{ 0x56, 1, 0xce }, { 0x82, 1, 0xce }, { 0x44, 1, 0xce }, { 0x52, 1, 0xce },
+		{ 0x63, 1, 0xce }, { 0x5e, 1, 0xce }, { 0x68, 1, 0xce }, { 0x03, 5, 0xce },
+	},
+	[0xc2] = {
+		{ 0x55, 1, 0xaf }, { 0x43, 1, 0xaf }, { 0x5d, 1, 0xaf }, { 0x02, 5, 0xaf },
+		{ 0x55, 1, 0xb4 }, { 0x43, 1, 0xb4 }, { 0x5d, 1, 0xb4 }, { 0x02, 5, 0xb4 },
+		{ 0x55, 1, 0xb6 }, { 0x43, 1, 0xb6 }, { 0x5d, 1, 0xb6 }, { 0x02, 5, 0xb6 },
+		{ 0x55, 1, 0xb7 }, { 0x43, 1, 0xb7 }, { 0x5d, 1, 0xb7 }, { 0x02, 5, 0xb7 },
+	},
+	[0xc3] = {
+		{ 0x56, 1, 0xaf }, { 0x82, 1, 0xaf }, { 0x44, 1, 0xaf }, { 0x52, 1, 0xaf },
+		{ 0x63, 1, 0xaf }, { 0x5e, 1, 0xaf }, { 0x68, 1, 0xaf }, { 0x03, 5, 0xaf },
+		{ 0x56, 1, 0xb4 }, { 0x82, 1, 0xb4 }, { 0x44, 1, 0xb4 }, { 0x52, 1, 0xb4 },
+		{ 0x63, 1, 0xb4 }, { 0x5e, 1, 0xb4 }, { 0x68, 1, 0xb4 }, { 0x03, 5, 0xb4 },
+	},
+	[0xc4] = {
+		{ 0x42, 1, 0xb0 }, { 0x01, 5, 0xb0 }, { 0x42, 1, 0xb1 }, { 0x01, 5, 0xb1 },
+		{ 0x42, 1, 0xb3 }, { 0x01, 5, 0xb3 }, { 0x42, 1, 0xd1 }, { 0x01, 5, 0xd1 },
+		{ 0x42, 1, 0xd8 }, { 0x01, 5, 0xd8 }, { 0x42, 1, 0xd9 }, { 0x01, 5, 0xd9 },
+		{ 0x42, 1, 0xe3 }, { 0x01, 5, 0xe3 }, { 0x42, 1, 0xe5 }, { 0x01, 5, 0xe5 },
+	},
+	[0xc5] = {
+		{ 0x55, 1, 0xb0 }, { 0x43, 1, 0xb0 }, { 0x5d, 1, 0xb0 }, { 0x02, 5, 0xb0 },
+		{ 0x55, 1, 0xb1 }, { 0x43, 1, 0xb1 }, { 0x5d, 1, 0xb1 }, { 0x02, 5, 0xb1 },
+		{ 0x55, 1, 0xb3 }, { 0x43, 1, 0xb3 }, { 0x5d, 1, 0xb3 }, { 0x02, 5, 0xb3 },
+		{ 0x55, 1, 0xd1 }, { 0x43, 1, 0xd1 }, { 0x5d, 1, 0xd1 }, { 0x02, 5, 0xd1 },
+	},
+	[0xc6] = {
+		{ 0x56, 1, 0xb0 }, { 0x82, 1, 0xb0 }, { 0x44, 1, 0xb0 }, { 0x52, 1, 0xb0 },
+		{ 0x63, 1, 0xb0 }, { 0x5e, 1, 0xb0 }, { 0x68, 1, 0xb0 }, { 0x03, 5, 0xb0 },
+		{ 0x56, 1, 0xb1 }, { 0x82, 1, 0xb1 }, { 0x44, 1, 0xb1 }, { 0x52, 1, 0xb1 },
+		{ 0x63, 1, 0xb1 }, { 0x5e, 1, 0xb1 }, { 0x68, 1, 0xb1 }, { 0x03, 5, 0xb1 },
+	},
+	[0xc7] = {
+		{ 0x42, 1, 0xb2 }, { 0x01, 5, 0xb2 }, { 0x42, 1, 0xb5 }, { 0x01, 5, 0xb5 },
+		{ 0x42, 1, 0xb9 }, { 0x01, 5, 0xb9 }, { 0x42, 1, 0xba }, { 0x01, 5, 0xba },
+		{ 0x42, 1, 0xbb }, { 0x01, 5, 0xbb }, { 0x42, 1, 0xbd }, { 0x01, 5, 0xbd },
+		{ 0x42, 1, 0xbe }, { 0x01, 5, 0xbe }, { 0x42, 1, 0xc4 }, { 0x01, 5, 0xc4 },
+	},
+	[0xc8] = {
+		{ 0x55, 1, 0xb2 }, { 0x43, 1, 0xb2 }, { 0x5d, 1, 0xb2 }, { 0x02, 5, 0xb2 },
+		{ 0x55, 1, 0xb5 }, { 0x43, 1, 0xb5 }, { 0x5d, 1, 0xb5 }, { 0x02, 5, 0xb5 },
+		{ 0x55, 1, 0xb9 }, { 0x43, 1, 0xb9 }, { 0x5d, 1, 0xb9 }, { 0x02, 5, 0xb9 },
+		{ 0x55, 1, 0xba }, { 0x43, 1, 0xba }, { 0x5d, 1, 0xba }, { 0x02, 5, 0xba },
+	},
+	[0xc9] = {
+		{ 0x56, 1, 0xb2 }, { 0x82, 1, 0xb2 }, { 0x44, 1, 0xb2 }, { 0x52, 1, 0xb2 },
+		{ 0x63, 1, 0xb2 }, { 0x5e, 1, 0xb2 }, { 0x68, 1, 0xb2 }, { 0x03, 5, 0xb2 },
+		{ 0x56, 1, 0xb5 }, { 0x82, 1, 0xb5 }, { 0x44, 1, 0xb5 }, { 0x52, 1, 0xb5 },
+		{ 0x63, 1, 0xb5 }, { 0x5e, 1, 0xb5 }, { 0x68, 1, 0xb5 }, { 0x03, 5, 0xb5 },
+	},
+	[0xca] = {
+		{ 0x56, 1, 0xb3 }, { 0x82, 1, 0xb3 }, { 0x44, 1, 0xb3 }, { 0x52, 1, 0xb3 },
+		{ 0x63, 1, 0xb3 }, { 0x5e, 1, 0xb3 }, { 0x68, 1, 0xb3 }, { 0x03, 5, 0xb3 },
+		{ 0x56, 1, 0xd1 }, { 0x82, 1, 0xd1 }, { 0x44, 1, 0xd1 }, { 0x52, 1, 0xd1 },
+		{ 0x63, 1, 0xd1 }, { 0x5e, 1, 0xd1 }, { 0x68, 1, 0xd1 }, { 0x03, 5, 0xd1 },
+	},
+	[0xcb] = {
+		{ 0x56, 1, 0xb6 }, { 0x82, 1, 0xb6 }, { 0x44, 1, 0xb6 }, { 0x52, 1, 0xb6 },
+		{ 0x63, 1, 0xb6 }, { 0x5e, 1, 0xb6 }, { 0x68, 1, 0xb6 }, { 0x03, 5, 0xb6 },
+		{ 0x56, 1, 0xb7 }, { 0x82, 1, 0xb7 }, { 0x44, 1, 0xb7 }, { 0x52, 1, 0xb7 },
+		{ 0x63, 1, 0xb7 }, { 0x5e, 1, 0xb7 }, { 0x68, 1, 0xb7 }, { 0x03, 5, 0xb7 },
+	},
+	[0xcc] = {
+		{ 0x56, 1, 0xb8 }, { 0x82, 1, 0xb8 }, { 0x44, 1, 0xb8 }, { 0x52, 1, 0xb8 },
+		{ 0x63, 1, 0xb8 }, { 0x5e, 1, 0xb8 }, { 0x68, 1, 0xb8 }, { 0x03, 5, 0xb8 },
+		{ 0x56, 1, 0xc2 }, { 0x82, 1, 0xc2 }, { 0x44, 1, 0xc2 }, { 0x52, 1, 0xc2 },
+		{ 0x63, 1, 0xc2 }, { 0x5e, 1, 0xc2 }, { 0x68, 1, 0xc2 }, { 0x03, 5, 0xc2 },
+	},
+	[0xcd] = {
+		{ 0x56, 1, 0xb9 }, { 0x82, 1, 0xb9 }, { 0x44, 1, 0xb9 }, { 0x52, 1, 0xb9 },
+		{ 0x63, 1, 0xb9 }, { 0x5e, 1, 0xb9 }, { 0x68, 1, 0xb9 }, { 0x03, 5, 0xb9 },
+		{ 0x56, 1, 0xba }, { 0x82, 1, 0xba }, { 0x44, 1, 0xba }, { 0x52, 1, 0xba },
+		{ 0x63, 1, 0xba }, { 0x5e, 1, 0xba }, { 0x68, 1, 0xba }, { 0x03, 5, 0xba },
+	},
+	[0xce] = {
+		{ 0x55, 1, 0xbb }, { 0x43, 1, 0xbb }, { 0x5d, 1, 0xbb }, { 0x02, 5, 0xbb },
+		{ 0x55, 1, 0xbd }, { 0x43, 1, 0xbd }, { 0x5d, 1, 0xbd }, { 0x02, 5, 0xbd },
+		{ 0x55, 1, 0xbe }, { 0x43, 1, 0xbe }, { 0x5d, 1, 0xbe }, { 0x02, 5, 0xbe },
+		{ 0x55, 1, 0xc4 }, { 0x43, 1, 0xc4 }, { 0x5d, 1, 0xc4 }, { 0x02, 5, 0xc4 },
+	},
+	[0xcf] = {
+		{ 0x56, 1, 0xbb }, { 0x82, 1, 0xbb }, { 0x44, 1, 0xbb }, { 0x52, 1, 0xbb },
+		{ 0x63, 1, 0xbb }, { 0x5e, 1, 0xbb }, { 0x68, 1, 0xbb }, { 0x03, 5, 0xbb },
+		{ 0x56, 1, 0xbd }, { 0x82, 1, 0xbd }, { 0x44, 1, 0xbd }, { 0x52, 1, 0xbd },
+		{ 0x63, 1, 0xbd }, { 0x5e, 1, 0xbd }, { 0x68, 1, 0xbd }, { 0x03, 5, 0xbd },
+	},
+	[0xd0] = {
+		{ 0x55, 1, 0xbc }, { 0x43, 1, 0xbc }, { 0x5d, 1, 0xbc }, { 0x02, 5, 0xbc },
+		{ 0x55, 1, 0xbf }, { 0x43, 1, 0xbf }, { 0x5d, 1, 0xbf }, { 0x02, 5, 0xbf },
+		{ 0x55, 1, 0xc5 }, { 0x43, 1, 0xc5 }, { 0x5d, 1, 0xc5 }, { 0x02, 5, 0xc5 },
+		{ 0x55, 1, 0xe7 }, { 0x43, 1, 0xe7 }, { 0x5d, 1, 0xe7 }, { 0x02, 5, 0xe7 },
+	},
+	[0xd1] = {
+		{ 0x56, 1, 0xbc }, { 0x82, 1, 0xbc }, { 0x44, 1, 0xbc }, { 0x52, 1, 0xbc },
+		{ 0x63, 1, 0xbc }, { 0x5e, 1, 0xbc }, { 0x68, 1, 0xbc }, { 0x03, 5, 0xbc },
+		{ 0x56, 1, 0xbf }, { 0x82, 1, 0xbf }, { 0x44, 1, 0xbf }, { 0x52, 1, 0xbf },
+		{ 0x63, 1, 0xbf }, { 0x5e, 1, 0xbf }, { 0x68, 1, 0xbf }, { 0x03, 5, 0xbf },
+	},
+	[0xd2] = {
+		{ 0x56, 1, 0xbe }, { 0x82, 1, 0xbe }, { 0x44, 1, 0xbe }, { 0x52, 1, 0xbe },
+		{ 0x63, 1, 0xbe }, { 0x5e, 1, 0xbe }, { 0x68, 1, 0xbe }, { 0x03, 5, 0xbe },
+		{ 0x56, 1, 0xc4 }, { 0x82, 1, 0xc4 }, { 0x44, 1, 0xc4 }, { 0x52, 1, 0xc4 },
+		{ 0x63, 1, 0xc4 }, { 0x5e, 1, 0xc4 }, { 0x68, 1, 0xc4 }, { 0x03, 5, 0xc4 },
+	},
+	[0xd3] = {
+		{ 0x00, 5, 0xc0 }, { 0x00, 5, 0xc1 }, { 0x00, 5, 0xc8 }, { 0x00, 5, 0xc9 },
+		{ 0x00, 5, 0xca }, { 0x00, 5, 0xcd }, { 0x00, 5, 0xd2 }, { 0x00, 5, 0xd5 },
+		{ 0x00, 5, 0xda }, { 0x00, 5, 0xdb }, { 0x00, 5, 0xee }, { 0x00, 5, 0xf0 },
+		{ 0x00, 5, 0xf2 }, { 0x00, 5, 0xf3 }, { 0x00, 5, 0xff }, { 0xe3, 0, 0x00 },
+	},
+	[0xd4] = {
+		{ 0x42, 1, 0xc0 }, { 0x01, 5, 0xc0 }, { 0x42, 1, 0xc1 }, { 0x01, 5, 0xc1 },
+		{ 0x42, 1, 0xc8 }, { 0x01, 5, 0xc8 }, { 0x42, 1, 0xc9 }, { 0x01, 5, 0xc9 },
+		{ 0x42, 1, 0xca }, { 0x01, 5, 0xca }, { 0x42, 1, 0xcd }, { 0x01, 5, 0xcd },
+		{ 0x42, 1, 0xd2 }, { 0x01, 5, 0xd2 }, { 0x42, 1, 0xd5 }, { 0x01, 5, 0xd5 },
+	},
+	[0xd5] = {
+		{ 0x55, 1, 0xc0 }, { 0x43, 1, 0xc0 }, { 0x5d, 1, 0xc0 }, { 0x02, 5, 0xc0 },
+		{ 0x55, 1, 0xc1 }, { 0x43, 1, 0xc1 }, { 0x5d, 1, 0xc1 }, { 0x02, 5, 0xc1 },
+		{ 0x55, 1, 0xc8 }, { 0x43, 1, 0xc8 }, { 0x5d, 1, 0xc8 }, { 0x02, 5, 0xc8 },
+		{ 0x55, 1, 0xc9 }, { 0x43, 1, 0xc9 }, { 0x5d, 1, 0xc9 }, { 0x02, 5, 0xc9 },
+	},
+	[0xd6] = {
+		{ 0x56, 1, 0xc0 }, { 0x82, 1, 0xc0 }, { 0x44, 1, 0xc0 }, { 0x52, 1, 0xc0 },
+		{ 0x63, 1, 0xc0 }, { 0x5e, 1, 0xc0 }, { 0x68, 1, 0xc0 }, { 0x03, 5, 0xc0 },
+		{ 0x56, 1, 0xc1 }, { 0x82, 1, 0xc1 }, { 0x44, 1, 0xc1 }, { 0x52, 1, 0xc1 },
+		{ 0x63, 1, 0xc1 }, { 0x5e, 1, 0xc1 }, { 0x68, 1, 0xc1 }, { 0x03, 5, 0xc1 },
+	},
+	[0xd7] = {
+		{ 0x56, 1, 0xc5 }, { 0x82, 1, 0xc5 }, { 0x44, 1, 0xc5 }, { 0x52, 1, 0xc5 },
+		{ 0x63, 1, 0xc5 }, { 0x5e, 1, 0xc5 }, { 0x68, 1, 0xc5 }, { 0x03, 5, 0xc5 },
+		{ 0x56, 1, 0xe7 }, { 0x82, 1, 0xe7 }, { 0x44, 1, 0xe7 }, { 0x52, 1, 0xe7 },
+		{ 0x63, 1, 0xe7 }, { 0x5e, 1, 0xe7 }, { 0x68, 1, 0xe7 }, { 0x03, 5, 0xe7 },
+	},
+	[0xd8] = {
+		{ 0x55, 1, 0xc6 }, { 0x43, 1, 0xc6 }, { 0x5d, 1, 0xc6 }, { 0x02, 5, 0xc6 },
+		{ 0x55, 1, 0xe4 }, { 0x43, 1, 0xe4 }, { 0x5d, 1, 0xe4 }, { 0x02, 5, 0xe4 },
+		{ 0x55, 1, 0xe8 }, { 0x43, 1, 0xe8 }, { 0x5d, 1, 0xe8 }, { 0x02, 5, 0xe8 },
+		{ 0x55, 1, 0xe9 }, { 0x43, 1, 0xe9 }, { 0x5d, 1, 0xe9 }, { 0x02, 5, 0xe9 },
+	},
+	[0xd9] = {
+		{ 0x56, 1, 0xc6 }, { 0x82, 1, 0xc6 }, { 0x44, 1, 0xc6 }, { 0x52, 1, 0xc6 },
+		{ 0x63, 1, 0xc6 }, { 0x5e, 1, 0xc6 }, { 0x68, 1, 0xc6 }, { 0x03, 5, 0xc6 },
+		{ 0x56, 1, 0xe4 }, { 0x82, 1, 0xe4 }, { 0x44, 1, 0xe4 }, { 0x52, 1, 0xe4 },
+		{ 0x63, 1, 0xe4 }, { 0x5e, 1, 0xe4 }, { 0x68, 1, 0xe4 }, { 0x03, 5, 0xe4 },
+	},
+	[0xda] = {
+		{ 0x55, 1, 0xec }, { 0x43, 1, 0xec }, { 0x5d, 1, 0xec }, { 0x02, 5, 0xec },
+		{ 0x55, 1, 0xed }, { 0x43, 1, 0xed }, { 0x5d, 1, 0xed }, { 0x02, 5, 0xed },
+		{ 0x42, 1, 0xc7 }, { 0x01, 5, 0xc7 }, { 0x42, 1, 0xcf }, { 0x01, 5, 0xcf },
+		{ 0x42, 1, 0xea }, { 0x01, 5, 0xea }, { 0x42, 1, 0xeb }, { 0x01, 5, 0xeb },
+	},
+	[0xdb] = {
+		{ 0x55, 1, 0xc7 }, { 0x43, 1, 0xc7 }, { 0x5d, 1, 0xc7 }, { 0x02, 5, 0xc7 },
+		{ 0x55, 1, 0xcf }, { 0x43, 1, 0xcf }, { 0x5d, 1, 0xcf }, { 0x02, 5, 0xcf },
+		{ 0x55, 1, 0xea }, { 0x43, 1, 0xea }, { 0x5d, 1, 0xea }, { 0x02, 5, 0xea },
+		{ 0x55, 1, 0xeb }, { 0x43, 1, 0xeb }, { 0x5d, 1, 0xeb }, { 0x02, 5, 0xeb },
+	},
+	[0xdc] = {
+		{ 0x56, 1, 0xc7 }, { 0x82, 1, 0xc7 }, { 0x44, 1, 0xc7 }, { 0x52, 1, 0xc7 },
+		{ 0x63, 1, 0xc7 }, { 0x5e, 1, 0xc7 }, { 0x68, 1, 0xc7 }, { 0x03, 5, 0xc7 },
+		{ 0x56, 1, 0xcf }, { 0x82, 1, 0xcf }, { 0x44, 1, 0xcf }, { 0x52, 1, 0xcf },
+		{ 0x63, 1, 0xcf }, { 0x5e, 1, 0xcf }, { 0x68, 1, 0xcf }, { 0x03, 5, 0xcf },
+	},
+	[0xdd] = {
+		{ 0x56, 1, 0xc8 }, { 0x82, 1, 0xc8 }, { 0x44, 1, 0xc8 }, { 0x52, 1, 0xc8 },
+		{ 0x63, 1, 0xc8 }, { 0x5e, 1, 0xc8 }, { 0x68, 1, 0xc8 }, { 0x03, 5, 0xc8 },
+		{ 0x56, 1, 0xc9 }, { 0x82, 1, 0xc9 }, { 0x44, 1, 0xc9 }, { 0x52, 1, 0xc9 },
+		{ 0x63, 1, 0xc9 }, { 0x5e, 1, 0xc9 }, { 0x68, 1, 0xc9 }, { 0x03, 5, 0xc9 },
+	},
+	[0xde] = {
+		{ 0x55, 1, 0xca }, { 0x43, 1, 0xca }, { 0x5d, 1, 0xca }, { 0x02, 5, 0xca },
+		{ 0x55, 1, 0xcd }, { 0x43, 1, 0xcd }, { 0x5d, 1, 0xcd }, { 0x02, 5, 0xcd },
+		{ 0x55, 1, 0xd2 }, { 0x43, 1, 0xd2 }, { 0x5d, 1, 0xd2 }, { 0x02, 5, 0xd2 },
+		{ 0x55, 1, 0xd5 }, { 0x43, 1, 0xd5 }, { 0x5d, 1, 0xd5 }, { 0x02, 5, 0xd5 },
+	},
+	[0xdf] = {
+		{ 0x56, 1, 0xca }, { 0x82, 1, 0xca }, { 0x44, 1, 0xca }, { 0x52, 1, 0xca },
+		{ 0x63, 1, 0xca }, { 0x5e, 1, 0xca }, { 0x68, 1, 0xca }, { 0x03, 5, 0xca },
+		{ 0x56, 1, 0xcd }, { 0x82, 1, 0xcd }, { 0x44, 1, 0xcd }, { 0x52, 1, 0xcd },
+		{ 0x63, 1, 0xcd }, { 0x5e, 1, 0xcd }, { 0x68, 1, 0xcd }, { 0x03, 5, 0xcd },
+	},
+	[0xe0] = {
+		{ 0x42, 1, 0xda }, { 0x01, 5, 0xda }, { 0x42, 1, 0xdb }, { 0x01, 5, 0xdb },
+		{ 0x42, 1, 0xee }, { 0x01, 5, 0xee }, { 0x42, 1, 0xf0 }, { 0x01, 5, 0xf0 },
+		{ 0x42, 1, 0xf2 }, { 0x01, 5, 0xf2 }, { 0x42, 1, 0xf3 }, { 0x01, 5, 0xf3 },
+		{ 0x42, 1, 0xff }, { 0x01, 5, 0xff }, { 0x00, 5, 0xcb }, { 0x00, 5, 0xcc },
+	},
+	[0xe1] = {
+		{ 0x55, 1, 0xf2 }, { 0x43, 1, 0xf2 }, { 0x5d, 1, 0xf2 }, { 0x02, 5, 0xf2 },
+		{ 0x55, 1, 0xf3 }, { 0x43, 1, 0xf3 }, { 0x5d, 1, 0xf3 }, { 0x02, 5, 0xf3 },
+		{ 0x55, 1, 0xff }, { 0x43, 1, 0xff }, { 0x5d, 1, 0xff }, { 0x02, 5, 0xff },
+		{ 0x42, 1, 0xcb }, { 0x01, 5, 0xcb }, { 0x42, 1, 0xcc }, { 0x01, 5, 0xcc },
+	},
+	[0xe2] = {
+		{ 0x56, 1, 0xff }, { 0x82, 1, 0xff }, { 0x44, 1, 0xff }, { 0x52, 1, 0xff },
+		{ 0x63, 1, 0xff }, { 0x5e, 1, 0xff }, { 0x68, 1, 0xff }, { 0x03, 5, 0xff },
+		{ 0x55, 1, 0xcb }, { 0x43, 1, 0xcb }, { 0x5d, 1, 0xcb }, { 0x02, 5, 0xcb },
+		{ 0x55, 1, 0xcc }, { 0x43, 1, 0xcc }, { 0x5d, 1, 0xcc }, { 0x02, 5, 0xcc },
+	},
+	[0xe3] = {
+		{ 0x56, 1, 0xcb }, { 0x82, 1, 0xcb }, { 0x44, 1, 0xcb }, { 0x52, 1, 0xcb },
+		{ 0x63, 1, 0xcb }, { 0x5e, 1, 0xcb }, { 0x68, 1, 0xcb }, { 0x03, 5, 0xcb },
+		{ 0x56, 1, 0xcc }, { 0x82, 1, 0xcc }, { 0x44, 1, 0xcc }, { 0x52, 1, 0xcc },
+		{ 0x63, 1, 0xcc }, { 0x5e, 1, 0xcc }, { 0x68, 1, 0xcc }, { 0x03, 5, 0xcc },
+	},
+	[0xe4] = {
+		{ 0x56, 1, 0xd2 }, { 0x82, 1, 0xd2 }, { 0x44, 1, 0xd2 }, { 0x52, 1, 0xd2 },
+		{ 0x63, 1, 0xd2 }, { 0x5e, 1, 0xd2 }, { 0x68, 1, 0xd2 }, { 0x03, 5, 0xd2 },
+		{ 0x56, 1, 0xd5 }, { 0x82, 1, 0xd5 }, { 0x44, 1, 0xd5 }, { 0x52, 1, 0xd5 },
+		{ 0x63, 1, 0xd5 }, { 0x5e, 1, 0xd5 }, { 0x68, 1, 0xd5 }, { 0x03, 5, 0xd5 },
+	},
+	[0xe5] = {
+		{ 0x00, 5, 0xd3 }, { 0x00, 5, 0xd4 }, { 0x00, 5, 0xd6 }, { 0x00, 5, 0xdd },
+		{ 0x00, 5, 0xde }, { 0x00, 5, 0xdf }, { 0x00, 5, 0xf1 }, { 0x00, 5, 0xf4 },
+		{ 0x00, 5, 0xf5 }, { 0x00, 5, 0xf6 }, { 0x00, 5, 0xf7 }, { 0x00, 5, 0xf8 },
+		{ 0x00, 5, 0xfa }, { 0x00, 5, 0xfb }, { 0x00, 5, 0xfc }, { 0x00, 5, 0xfd },
+	},
+	[0xe6] = {
+		{ 0x42, 1, 0xd3 }, { 0x01, 5, 0xd3 }, { 0x42, 1, 0xd4 }, { 0x01, 5, 0xd4 },
+		{ 0x42, 1, 0xd6 }, { 0x01, 5, 0xd6 }, { 0x42, 1, 0xdd }, { 0x01, 5, 0xdd },
+		{ 0x42, 1, 0xde }, { 0x01, 5, 0xde }, { 0x42, 1, 0xdf }, { 0x01, 5, 0xdf },
+		{ 0x42, 1, 0xf1 }, { 0x01, 5, 0xf1 }, { 0x42, 1, 0xf4 }, { 0x01, 5, 0xf4 },
+	},
+	[0xe7] = {
+		{ 0x55, 1, 0xd3 }, { 0x43, 1, 0xd3 }, { 0x5d, 1, 0xd3 }, { 0x02, 5, 0xd3 },
+		{ 0x55, 1, 0xd4 }, { 0x43, 1, 0xd4 }, { 0x5d, 1, 0xd4 }, { 0x02, 5, 0xd4 },
+		{ 0x55, 1, 0xd6 }, { 0x43, 1, 0xd6 }, { 0x5d, 1, 0xd6 }, { 0x02, 5, 0xd6 },
+		{ 0x55, 1, 0xdd }, { 0x43, 1, 0xdd }, { 0x5d, 1, 0xdd }, { 0x02, 5, 0xdd },
+	},
+	[0xe8] = {
+		{ 0x56, 1, 0xd3 }, { 0x82, 1, 0xd3 }, { 0x44, 1, 0xd3 }, { 0x52, 1, 0xd3 },
+		{ 0x63, 1, 0xd3 }, { 0x5e, 1, 0xd3 }, { 0x68, 1, 0xd3 }, { 0x03, 5, 0xd3 },
+		{ 0x56, 1, 0xd4 }, { 0x82, 1, 0xd4 }, { 0x44, 1, 0xd4 }, { 0x52, 1, 0xd4 },
+		{ 0x63, 1, 0xd4 }, { 0x5e, 1, 0xd4 }, { 0x68, 1, 0xd4 }, { 0x03, 5, 0xd4 },
+	},
+	[0xe9] = {
+		{ 0x56, 1, 0xd6 }, { 0x82, 1, 0xd6 }, { 0x44, 1, 0xd6 }, { 0x52, 1, 0xd6 },
+		{ 0x63, 1, 0xd6 }, { 0x5e, 1, 0xd6 }, { 0x68, 1, 0xd6 }, { 0x03, 5, 0xd6 },
+		{ 0x56, 1, 0xdd }, { 0x82, 1, 0xdd }, { 0x44, 1, 0xdd }, { 0x52, 1, 0xdd },
+		{ 0x63, 1, 0xdd }, { 0x5e, 1, 0xdd }, { 0x68, 1, 0xdd }, { 0x03, 5, 0xdd },
+	},
+	[0xea] = {
+		{ 0x56, 1, 0xd7 }, { 0x82, 1, 0xd7 }, { 0x44, 1, 0xd7 }, { 0x52, 1, 0xd7 },
+		{ 0x63, 1, 0xd7 }, { 0x5e, 1, 0xd7 }, { 0x68, 1, 0xd7 }, { 0x03, 5, 0xd7 },
+		{ 0x56, 1, 0xe1 }, { 0x82, 1, 0xe1 }, { 0x44, 1, 0xe1 }, { 0x52, 1, 0xe1 },
+		{ 0x63, 1, 0xe1 }, { 0x5e, 1, 0xe1 }, { 0x68, 1, 0xe1 }, { 0x03, 5, 0xe1 },
+	},
+	[0xeb] = {
+		{ 0x55, 1, 0xd8 }, { 0x43, 1, 0xd8 }, { 0x5d, 1, 0xd8 }, { 0x02, 5, 0xd8 },
+		{ 0x55, 1, 0xd9 }, { 0x43, 1, 0xd9 }, { 0x5d, 1, 0xd9 }, { 0x02, 5, 0xd9 },
+		{ 0x55, 1, 0xe3 }, { 0x43, 1, 0xe3 }, { 0x5d, 1, 0xe3 }, { 0x02, 5, 0xe3 },
+		{ 0x55, 1, 0xe5 }, { 0x43, 1, 0xe5 }, { 0x5d, 1, 0xe5 }, { 0x02, 5, 0xe5 },
+	},
+	[0xec] = {
+		{ 0x56, 1, 0xd8 }, { 0x82, 1, 0xd8 }, { 0x44, 1, 0xd8 }, { 0x52, 1, 0xd8 },
+		{ 0x63, 1, 0xd8 }, { 0x5e, 1, 0xd8 }, { 0x68, 1, 0xd8 }, { 0x03, 5, 0xd8 },
+		{ 0x56, 1, 0xd9 }, { 0x82, 1, 0xd9 }, { 0x44, 1, 0xd9 }, { 0x52, 1, 0xd9 },
+		{ 0x63, 1, 0xd9 }, { 0x5e, 1, 0xd9 }, { 0x68, 1, 0xd9 }, { 0x03, 5, 0xd9 },
+	},
+	[0xed] = {
+		{ 0x55, 1, 0xda }, { 0x43, 1, 0xda }, { 0x5d, 1, 0xda }, { 0x02, 5, 0xda },
+		{ 0x55, 1, 0xdb }, { 0x43, 1, 0xdb }, { 0x5d, 1, 0xdb }, { 0x02, 5, 0xdb },
+		{ 0x55, 1, 0xee }, { 0x43, 1, 0xee }, { 0x5d, 1, 0xee }, { 0x02, 5, 0xee },
+		{ 0x55, 1, 0xf0 }, { 0x43, 1, 0xf0 }, { 0x5d, 1, 0xf0 }, { 0x02, 5, 0xf0 },
+	},
+	[0xee] = {
+		{ 0x56, 1, 0xda }, { 0x82, 1, 0xda }, { 0x44, 1, 0xda }, { 0x52, 1, 0xda },
+		{ 0x63, 1, 0xda }, { 0x5e, 1, 0xda }, { 0x68, 1, 0xda }, { 0x03, 5, 0xda },
+		{ 0x56, 1, 0xdb }, { 0x82, 1, 0xdb }, { 0x44, 1, 0xdb }, { 0x52, 1, 0xdb },
+		{ 0x63, 1, 0xdb }, { 0x5e, 1, 0xdb }, { 0x68, 1, 0xdb }, { 0x03, 5, 0xdb },
+	},
+	[0xef] = {
+		{ 0x55, 1, 0xde }, { 0x43, 1, 0xde }, { 0x5d, 1, 0xde }, { 0x02, 5, 0xde },
+		{ 0x55, 1, 0xdf }, { 0x43, 1, 0xdf }, { 0x5d, 1, 0xdf }, { 0x02, 5, 0xdf },
+		{ 0x55, 1, 0xf1 }, { 0x43, 1, 0xf1 }, { 0x5d, 1, 0xf1 }, { 0x02, 5, 0xf1 },
+		{ 0x55, 1, 0xf4 }, { 0x43, 1, 0xf4 }, { 0x5d, 1, 0xf4 }, { 0x02, 5, 0xf4 },
+	},
+	[0xf0] = {
+		{ 0x56, 1, 0xde }, { 0x82, 1, 0xde }, { 0x44, 1, 0xde }, { 0x52, 1, 0xde },
+		{ 0x63, 1, 0xde }, { 0x5e, 1, 0xde }, { 0x68, 1, 0xde }, { 0x03, 5, 0xde },
+		{ 0x56, 1, 0xdf }, { 0x82, 1, 0xdf }, { 0x44, 1, 0xdf }, { 0x52, 1, 0xdf },
+		{ 0x63, 1, 0xdf }, { 0x5e, 1, 0xdf }, { 0x68, 1, 0xdf }, { 0x03, 5, 0xdf },
+	},
+	[0xf1] = {
+		{ 0x56, 1, 0xe0 }, { 0x82, 1, 0xe0 }, { 0x44, 1, 0xe0 }, { 0x52, 1, 0xe0 },
+		{ 0x63, 1, 0xe0 }, { 0x5e, 1, 0xe0 }, { 0x68, 1, 0xe0 }, { 0x03, 5, 0xe0 },
+		{ 0x56, 1, 0xe2 }, { 0x82, 1, 0xe2 }, { 0x44, 1, 0xe2 }, { 0x52, 1, 0xe2 },
+		{ 0x63, 1, 0xe2 }, { 0x5e, 1, 0xe2 }, { 0x68, 1, 0xe2 }, { 0x03, 5, 0xe2 },
+	},
+	[0xf2] = {
+		{ 0x56, 1, 0xe3 }, { 0x82, 1, 0xe3 }, { 0x44, 1, 0xe3 }, { 0x52, 1, 0xe3 },
+		{ 0x63, 1, 0xe3 }, { 0x5e, 1, 0xe3 }, { 0x68, 1, 0xe3 }, { 0x03, 5, 0xe3 },
+		{ 0x56, 1, 0xe5 }, { 0x82, 1, 0xe5 }, { 0x44, 1, 0xe5 }, { 0x52, 1, 0xe5 },
+		{ 0x63, 1, 0xe5 }, { 0x5e, 1, 0xe5 }, { 0x68, 1, 0xe5 }, { 0x03, 5, 0xe5 },
+	},
+	[0xf3] = {
+		{ 0x56, 1, 0xe8 }, { 0x82, 1, 0xe8 }, { 0x44, 1, 0xe8 }, { 0x52, 1, 0xe8 },
+		{ 0x63, 1, 0xe8 }, { 0x5e, 1, 0xe8 }, { 0x68, 1, 0xe8 }, { 0x03, 5, 0xe8 },
+		{ 0x56, 1, 0xe9 }, { 0x82, 1, 0xe9 }, { 0x44, 1, 0xe9 }, { 0x52, 1, 0xe9 },
+		{ 0x63, 1, 0xe9 }, { 0x5e, 1, 0xe9 }, { 0x68, 1, 0xe9 }, { 0x03, 5, 0xe9 },
+	},
+	[0xf4] = {
+		{ 0x56, 1, 0xea }, { 0x82, 1, 0xea }, { 0x44, 1, 0xea }, { 0x52, 1, 0xea },
+		{ 0x63, 1, 0xea }, { 0x5e, 1, 0xea }, { 0x68, 1, 0xea }, { 0x03, 5, 0xea },
+		{ 0x56, 1, 0xeb }, { 0x82, 1, 0xeb }, { 0x44, 1, 0xeb }, { 0x52, 1, 0xeb },
+		{ 0x63, 1, 0xeb }, { 0x5e, 1, 0xeb }, { 0x68, 1, 0xeb }, { 0x03, 5, 0xeb },
+	},
+	[0xf5] = {
+		{ 0x56, 1, 0xec }, { 0x82, 1, 0xec }, { 0x44, 1, 0xec }, { 0x52, 1, 0xec },
+		{ 0x63, 1, 0xec }, { 0x5e, 1, 0xec }, { 0x68, 1, 0xec }, { 0x03, 5, 0xec },
+		{ 0x56, 1, 0xed }, { 0x82, 1, 0xed }, { 0x44, 1, 0xed }, { 0x52, 1, 0xed },
+		{ 0x63, 1, 0xed }, { 0x5e, 1, 0xed }, { 0x68, 1, 0xed }, { 0x03, 5, 0xed },
+	},
+	[0xf6] = {
+		{ 0x56, 1, 0xee }, { 0x82, 1, 0xee }, { 0x44, 1, 0xee }, { 0x52, 1, 0xee },
+		{ 0x63, 1, 0xee }, { 0x5e, 1, 0xee }, { 0x68, 1, 0xee }, { 0x03, 5, 0xee },
+		{ 0x56, 1, 0xf0 }, { 0x82, 1, 0xf0 }, { 0x44, 1, 0xf0 }, { 0x52, 1, 0xf0 },
+		{ 0x63, 1, 0xf0 }, { 0x5e, 1, 0xf0 }, { 0x68, 1, 0xf0 }, { 0x03, 5, 0xf0 },
+	},
+	[0xf7] = {
+		{ 0x56, 1, 0xf1 }, { 0x82, 1, 0xf1 }, { 0x44, 1, 0xf1 }, { 0x52, 1, 0xf1 },
+		{ 0x63, 1, 0xf1 }, { 0x5e, 1, 0xf1 }, { 0x68, 1, 0xf1 }, { 0x03, 5, 0xf1 },
+		{ 0x56, 1, 0xf4 }, { 0x82, 1, 0xf4 }, { 0x44, 1, 0xf4 }, { 0x52, 1, 0xf4 },
+		{ 0x63, 1, 0xf4 }, { 0x5e, 1, 0xf4 }, { 0x68, 1, 0xf4 }, { 0x03, 5, 0xf4 },
+	},
+	[0xf8] = {
+		{ 0x56, 1, 0xf2 }, { 0x82, 1, 0xf2 }, { 0x44, 1, 0xf2 }, { 0x52, 1, 0xf2 },
+		{ 0x63, 1, 0xf2 }, { 0x5e, 1, 0xf2 }, { 0x68, 1, 0xf2 }, { 0x03, 5, 0xf2 },
+		{ 0x56, 1, 0xf3 }, { 0x82, 1, 0xf3 }, { 0x44, 1, 0xf3 }, { 0x52, 1, 0xf3 },
+		{ 0x63, 1, 0xf3 }, { 0x5e, 1, 0xf3 }, { 0x68, 1, 0xf3 }, { 0x03, 5, 0xf3 },
+	},
+	[0xf9] = {
+		{ 0x42, 1, 0xf5 }, { 0x01, 5, 0xf5 }, { 0x42, 1, 0xf6 }, { 0x01, 5, 0xf6 },
+		{ 0x42, 1, 0xf7 }, { 0x01, 5, 0xf7 }, { 0x42, 1, 0xf8 }, { 0x01, 5, 0xf8 },
+		{ 0x42, 1, 0xfa }, { 0x01, 5, 0xfa }, { 0x42, 1, 0xfb }, { 0x01, 5, 0xfb },
+		{ 0x42, 1, 0xfc }, { 0x01, 5, 0xfc }, { 0x42, 1, 0xfd }, { 0x01, 5, 0xfd },
+	},
+	[0xfa] = {
+		{ 0x55, 1, 0xf5 }, { 0x43, 1, 0xf5 }, { 0x5d, 1, 0xf5 }, { 0x02, 5, 0xf5 },
+		{ 0x55, 1, 0xf6 }, { 0x43, 1, 0xf6 }, { 0x5d, 1, 0xf6 }, { 0x02, 5, 0xf6 },
+		{ 0x55, 1, 0xf7 }, { 0x43, 1, 0xf7 }, { 0x5d, 1, 0xf7 }, { 0x02, 5, 0xf7 },
+		{ 0x55, 1, 0xf8 }, { 0x43, 1, 0xf8 }, { 0x5d, 1, 0xf8 }, { 0x02, 5, 0xf8 },
+	},
+	[0xfb] = {
+		{ 0x56, 1, 0xf5 }, { 0x82, 1, 0xf5 }, { 0x44, 1, 0xf5 }, { 0x52, 1, 0xf5 },
+		{ 0x63, 1, 0xf5 }, { 0x5e, 1, 0xf5 }, { 0x68, 1, 0xf5 }, { 0x03, 5, 0xf5 },
+		{ 0x56, 1, 0xf6 }, { 0x82, 1, 0xf6 }, { 0x44, 1, 0xf6 }, { 0x52, 1, 0xf6 },
+		{ 0x63, 1, 0xf6 }, { 0x5e, 1, 0xf6 }, { 0x68, 1, 0xf6 }, { 0x03, 5, 0xf6 },
+	},
+	[0xfc] = {
+		{ 0x56, 1, 0xf7 }, { 0x82, 1, 0xf7 }, { 0x44, 1, 0xf7 }, { 0x52, 1, 0xf7 },
+		{ 0x63, 1, 0xf7 }, { 0x5e, 1, 0xf7 }, { 0x68, 1, 0xf7 }, { 0x03, 5, 0xf7 },
+		{ 0x56, 1, 0xf8 }, { 0x82, 1, 0xf8 }, { 0x44, 1, 0xf8 }, { 0x52, 1, 0xf8 },
+		{ 0x63, 1, 0xf8 }, { 0x5e, 1, 0xf8 }, { 0x68, 1, 0xf8 }, { 0x03, 5, 0xf8 },
+	},
+	[0xfd] = {
+		{ 0x55, 1, 0xfa }, { 0x43, 1, 0xfa }, { 0x5d, 1, 0xfa }, { 0x02, 5, 0xfa },
+		{ 0x55, 1, 0xfb }, { 0x43, 1, 0xfb }, { 0x5d, 1, 0xfb }, { 0x02, 5, 0xfb },
+		{ 0x55, 1, 0xfc }, { 0x43, 1, 0xfc }, { 0x5d, 1, 0xfc }, { 0x02, 5, 0xfc },
+		{ 0x55, 1, 0xfd }, { 0x43, 1, 0xfd }, { 0x5d, 1, 0xfd }, { 0x02, 5, 0xfd },
+	},
+	[0xfe] = {
+		{ 0x56, 1, 0xfa }, { 0x82, 1, 0xfa }, { 0x44, 1, 0xfa }, { 0x52, 1, 0xfa },
+		{ 0x63, 1, 0xfa }, { 0x5e, 1, 0xfa }, { 0x68, 1, 0xfa }, { 0x03, 5, 0xfa },
+		{ 0x56, 1, 0xfb }, { 0x82, 1, 0xfb }, { 0x44, 1, 0xfb }, { 0x52, 1, 0xfb },
+		{ 0x63, 1, 0xfb }, { 0x5e, 1, 0xfb }, { 0x68, 1, 0xfb }, { 0x03, 5, 0xfb },
+	},
+	[0xff] = {
+		{ 0x56, 1, 0xfc }, { 0x82, 1, 0xfc }, { 0x44, 1, 0xfc }, { 0x52, 1, 0xfc },
+		{ 0x63, 1, 0xfc }, { 0x5e, 1, 0xfc }, { 0x68, 1, 0xfc }, { 0x03, 5, 0xfc },
+		{ 0x56, 1, 0xfd }, { 0x82, 1, 0xfd }, { 0x44, 1, 0xfd }, { 0x52, 1, 0xfd },
+		{ 0x63, 1, 0xfd }, { 0x5e, 1, 0xfd }, { 0x68, 1, 0xfd }, { 0x03, 5, 0xfd },
+	},
+};
@@ -0,0 +1,2054 @@
+/* Multi-symbol reversed huffman table, generated by "gen-rht -m 11".
+ * Do not edit, it is indexed on the 11 upper bits of the stream. Entries
+ * with l1 == 0 start with a code longer than this and must be looked up
+ * in the cascaded tables.
+ */
+#define RHT_MS_BITS 11
+
+static const struct rht_ms rht_ms[1 << RHT_MS_BITS] = {
+	[0x000] = { .c = { 0x30, 0x30 }, .l1 = 5, .l = 10 },
+	[0x001] = { .c = { 0x30, 0x30 }, .l1 = 5, .l = 10 },
+	[0x002] = { .c = { 0x30, 0x31 }, .l1 = 5, .l = 10 },
+	[0x003] = { .c = { 0x30, 0x31 }, .l1 = 5, .l = 10 },
+	[0x004] = { .c = { 0x30, 0x32 }, .l1 = 5, .l = 10 },
+	[0x005] = { .c = { 0x30, 0x32 }, .l1 = 5, .l = 10 },
+	[0x006] = { .c = { 0x30, 0x61 }, .l1 = 5, .l = 10 },
+	[0x007] = { .c = { 0x30, 0x61 }, .l1 = 5, .l = 10 },
+	[0x008] = { .c = { 0x30, 0x63 }, .l1 = 5, .l = 10 },
+	[0x009] = { .c = { 0x30, 0x63 }, .l1 = 5, .l = 10 },
+	[0x00a] = { .c = { 0x30, 0x65 }, .l1 = 5, .l = 10 },
+	[0x00b] = { .c = { 0x30, 0x65 }, .l1 = 5, .l = 10 },
+	[0x00c] = { .c = { 0x30, 0x69 }, .l1 = 5, .l = 10 },
+	[0x00d] = { .c = { 0x30, 0x69 }, .l1 = 5, .l = 10 },
+	[0x00e] = { .c = { 0x30, 0x6f }, .l1 = 5, .l = 10 },
+	[0x00f] = { .c = { 0x30, 0x6f }, .l1 = 5, .l = 10 },
+	[0x010] = { .c = { 0x30, 0x73 }, .l1 = 5, .l = 10 },
+	[0x011] = { .c = { 0x30, 0x73 }, .l1 = 5, .l = 10 },
+	[0x012] = { .c = { 0x30, 0x74 }, .l1 = 5, .l = 10 },
+	[0x013] = { .c = { 0x30, 0x74 }, .l1 = 5, .l = 10 },
+	[0x014] = { .c = { 0x30, 0x20 }, .l1 = 5, .l = 11 },
+	[0x015] = { .c = { 0x30, 0x25 }, .l1 = 5, .l = 11 },
+	[0x016] = { .c = { 0x30, 0x2d }, .l1 = 5, .l = 11 },
+	[0x017] = { .c = { 0x30, 0x2e }, .l1 = 5, .l = 11 },
+	[0x018] = { .c = { 0x30, 0x2f }, .l1 = 5, .l = 11 },
+	[0x019] = { .c = { 0x30, 0x33 }, .l1 = 5, .l = 11 },
+	[0x01a] = { .c = { 0x30, 0x34 }, .l1 = 5, .l = 11 },
+	[0x01b] = { .c = { 0x30, 0x35 }, .l1 = 5, .l = 11 },
+	[0x01c] = { .c = { 0x30, 0x36 }, .l1 = 5, .l = 11 },
+	[0x01d] = { .c = { 0x30, 0x37 }, .l1 = 5, .l = 11 },
+	[0x01e] = { .c = { 0x30, 0x38 }, .l1 = 5, .l = 11 },
+	[0x01f] = { .c = { 0x30, 0x39 }, .l1 = 5, .l = 11 },
+	[0x020] = { .c = { 0x30, 0x3d }, .l1 = 5, .l = 11 },
+	[0x021] = { .c = { 0x30, 0x41 }, .l1 = 5, .l = 11 },
+	[0x022] = { .c = { 0x30, 0x5f }, .l1 = 5, .l = 11 },
+	[0x023] = { .c = { 0x30, 0x62 }, .l1 = 5, .l = 11 },
+	[0x024] = { .c = { 0x30, 0x64 }, .l1 = 5, .l = 11 },
+	[0x025] = { .c = { 0x30, 0x66 }, .l1 = 5, .l = 11 },
+	[0x026] = { .c = { 0x30, 0x67 }, .l1 = 5, .l = 11 },
+	[0x027] = { .c = { 0x30, 0x68 }, .l1 = 5, .l = 11 },
+	[0x028] = { .c = { 0x30, 0x6c }, .l1 = 5, .l = 11 },
+	[0x029] = { .c = { 0x30, 0x6d }, .l1 = 5, .l = 11 },
+	[0x02a] = { .c = { 0x30, 0x6e }, .l1 = 5, .l = 11 },
+	[0x02b] = { .c = { 0x30, 0x70 }, .l1 = 5, .l = 11 },
+	[0x02c] = { .c = { 0x30, 0x72 }, .l1 = 5, .l = 11 },
+	[0x02d] = { .c = { 0x30, 0x75 }, .l1 = 5, .l = 11 },
+	[0x02e] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x02f] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x030] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x031] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x032] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x033] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x034] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x035] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x036] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x037] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x038] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x039] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x03a] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x03b] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x03c] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x03d] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x03e] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x03f] = { .c = { 0x30, 0x00 }, .l1 = 5, .l = 5 },
+	[0x040] = { .c = { 0x31, 0x30 }, .l1 = 5, .l = 10 },
+	[0x041] = { .c = { 0x31, 0x30 }, .l1 = 5, .l = 10 },
+	[0x042] = { .c = { 0x31, 0x31 }, .l1 = 5, .l = 10 },
+	[0x043] = { .c = { 0x31, 0x31 }, .l1 = 5, .l = 10 },
+	[0x044] = { .c = { 0x31, 0x32 }, .l1 = 5, .l = 10 },
+	[0x045] = { .c = { 0x31, 0x32 }, .l1 = 5, .l = 10 },
+	[0x046] = { .c = { 0x31, 0x61 }, .l1 = 5, .l = 10 },
+	[0x047] = { .c = { 0x31, 0x61 }, .l1 = 5, .l = 10 },
+	[0x048] = { .c = { 0x31, 0x63 }, .l1 = 5, .l = 10 },
+	[0x049] = { .c = { 0x31, 0x63 }, .l1 = 5, .l = 10 },
+	[0x04a] = { .c = { 0x31, 0x65 }, .l1 = 5, .l = 10 },
+	[0x04b] = { .c = { 0x31, 0x65 }, .l1 = 5, .l = 10 },
+	[0x04c] = { .c = { 0x31, 0x69 }, .l1 = 5, .l = 10 },
+	[0x04d] = { .c = { 0x31, 0x69 }, .l1 = 5, .l = 10 },
+	[0x04e] = { .c = { 0x31, 0x6f }, .l1 = 5, .l = 10 },
+	[0x04f] = { .c = { 0x31, 0x6f }, .l1 = 5, .l = 10 },
+	[0x050] = { .c = { 0x31, 0x73 }, .l1 = 5, .l = 10 },
+	[0x051] = { .c = { 0x31, 0x73 }, .l1 = 5, .l = 10 },
+	[0x052] = { .c = { 0x31, 0x74 }, .l1 = 5, .l = 10 },
+	[0x053] = { .c = { 0x31, 0x74 }, .l1 = 5, .l = 10 },
+	[0x054] = { .c = { 0x31, 0x20 }, .l1 = 5, .l = 11 },
+	[0x055] = { .c = { 0x31, 0x25 }, .l1 = 5, .l = 11 },
+	[0x056] = { .c = { 0x31, 0x2d }, .l1 = 5, .l = 11 },
+	[0x057] = { .c = { 0x31, 0x2e }, .l1 = 5, .l = 11 },
+	[0x058] = { .c = { 0x31, 0x2f }, .l1 = 5, .l = 11 },
+	[0x059] = { .c = { 0x31, 0x33 }, .l1 = 5, .l = 11 },
+	[0x05a] = { .c = { 0x31, 0x34 }, .l1 = 5, .l = 11 },
+	[0x05b] = { .c = { 0x31, 0x35 }, .l1 = 5, .l = 11 },
+	[0x05c] = { .c = { 0x31, 0x36 }, .l1 = 5, .l = 11 },
+	[0x05d] = { .c = { 0x31, 0x37 }, .l1 = 5, .l = 11 },
+	[0x05e] = { .c = { 0x31, 0x38 }, .l1 = 5, .l = 11 },
+	[0x05f] = { .c = { 0x31, 0x39 }, .l1 = 5, .l = 11 },
+	[0x060] = { .c = { 0x31, 0x3d }, .l1 = 5, .l = 11 },
+	[0x061] = { .c = { 0x31, 0x41 }, .l1 = 5, .l = 11 },
+	[0x062] = { .c = { 0x31, 0x5f }, .l1 = 5, .l = 11 },
+	[0x063] = { .c = { 0x31, 0x62 }, .l1 = 5, .l = 11 },
+	[0x064] = { .c = { 0x31, 0x64 }, .l1 = 5, .l = 11 },
+	[0x065] = { .c = { 0x31, 0x66 }, .l1 = 5, .l = 11 },
+	[0x066] = { .c = { 0x31, 0x67 }, .l1 = 5, .l = 11 },
+	[0x067] = { .c = { 0x31, 0x68 }, .l1 = 5, .l = 11 },
+	[0x068] = { .c = { 0x31, 0x6c }, .l1 = 5, .l = 11 },
+	[0x069] = { .c = { 0x31, 0x6d }, .l1 = 5, .l = 11 },
+	[0x06a] = { .c = { 0x31, 0x6e }, .l1 = 5, .l = 11 },
+	[0x06b] = { .c = { 0x31, 0x70 }, .l1 = 5, .l = 11 },
+	[0x06c] = { .c = { 0x31, 0x72 }, .l1 = 5, .l = 11 },
+	[0x06d] = { .c = { 0x31, 0x75 }, .l1 = 5, .l = 11 },
+	[0x06e] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x06f] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x070] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x071] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x072] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x073] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x074] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x075] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x076] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x077] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x078] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x079] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x07a] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x07b] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x07c] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x07d] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x07e] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x07f] = { .c = { 0x31, 0x00 }, .l1 = 5, .l = 5 },
+	[0x080] = { .c = { 0x32, 0x30 }, .l1 = 5, .l = 10 },
+	[0x081] = { .c = { 0x32, 0x30 }, .l1 = 5, .l = 10 },
+	[0x082] = { .c = { 0x32, 0x31 }, .l1 = 5, .l = 10 },
+	[0x083] = { .c = { 0x32, 0x31 }, .l1 = 5, .l = 10 },
+	[0x084] = { .c = { 0x32, 0x32 }, .l1 = 5, .l = 10 },
+	[0x085] = { .c = { 0x32, 0x32 }, .l1 = 5, .l = 10 },
+	[0x086] = { .c = { 0x32, 0x61 }, .l1 = 5, .l = 10 },
+	[0x087] = { .c = { 0x32, 0x61 }, .l1 = 5, .l = 10 },
+	[0x088] = { .c = { 0x32, 0x63 }, .l1 = 5, .l = 10 },
+	[0x089] = { .c = { 0x32, 0x63 }, .l1 = 5, .l = 10 },
+	[0x08a] = { .c = { 0x32, 0x65 }, .l1 = 5, .l = 10 },
+	[0x08b] = { .c = { 0x32, 0x65 }, .l1 = 5, .l = 10 },
+	[0x08c] = { .c = { 0x32, 0x69 }, .l1 = 5, .l = 10 },
+	[0x08d] = { .c = { 0x32, 0x69 }, .l1 = 5, .l = 10 },
+	[0x08e] = { .c = { 0x32, 0x6f }, .l1 = 5, .l = 10 },
+	[0x08f] = { .c = { 0x32, 0x6f }, .l1 = 5, .l = 10 },
+	[0x090] = { .c = { 0x32, 0x73 }, .l1 = 5, .l = 10 },
+	[0x091] = { .c = { 0x32, 0x73 }, .l1 = 5, .l = 10 },
+	[0x092] = { .c = { 0x32, 0x74 }, .l1 = 5, .l = 10 },
+	[0x093] = { .c = { 0x32, 0x74 }, .l1 = 5, .l = 10 },
+	[0x094] = { .c = { 0x32, 0x20 }, .l1 = 5, .l = 11 },
+	[0x095] = { .c = { 0x32, 0x25 }, .l1 = 5, .l = 11 },
+	[0x096] = { .c = { 0x32, 0x2d }, .l1 = 5, .l = 11 },
+	[0x097] = { .c = { 0x32, 0x2e }, .l1 = 5, .l = 11 },
+	[0x098] = { .c = { 0x32, 0x2f }, .l1 = 5, .l = 11 },
+	[0x099] = { .c = { 0x32, 0x33 }, .l1 = 5, .l = 11 },
+	[0x09a] = { .c = { 0x32, 0x34 }, .l1 = 5, .l = 11 },
+	[0x09b] = { .c = { 0x32, 0x35 }, .l1 = 5, .l = 11 },
+	[0x09c] = { .c = { 0x32, 0x36 }, .l1 = 5, .l = 11 },
+	[0x09d] = { .c = { 0x32, 0x37 }, .l1 = 5, .l = 11 },
+	[0x09e] = { .c = { 0x32, 0x38 }, .l1 = 5, .l = 11 },
+	[0x09f] = { .c = { 0x32, 0x39 }, .l1 = 5, .l = 11 },
+	[0x0a0] = { .c = { 0x32, 0x3d }, .l1 = 5, .l = 11 },
+	[0x0a1] = { .c = { 0x32, 0x41 }, .l1 = 5, .l = 11 },
+	[0x0a2] = { .c = { 0x32, 0x5f }, .l1 = 5, .l = 11 },
+	[0x0a3] = { .c = { 0x32, 0x62 }, .l1 = 5, .l = 11 },
+	[0x0a4] = { .c = { 0x32, 0x64 }, .l1 = 5, .l = 11 },
+	[0x0a5] = { .c = { 0x32, 0x66 }, .l1 = 5, .l = 11 },
+	[0x0a6] = { .c = { 0x32, 0x67 }, .l1 = 5, .l = 11 },
+	[0x0a7] = { .c = { 0x32, 0x68 }, .l1 = 5, .l = 11 },
+	[0x0a8] = { .c = { 0x32, 0x6c }, .l1 = 5, .l = 11 },
+	[0x0a9] = { .c = { 0x32, 0x6d }, .l1 = 5, .l = 11 },
+	[0x0aa] = { .c = { 0x32, 0x6e }, .l1 = 5, .l = 11 },
+	[0x0ab] = { .c = { 0x32, 0x70 }, .l1 = 5, .l = 11 },
+	[0x0ac] = { .c = { 0x32, 0x72 }, .l1 = 5, .l = 11 },
+	[0x0ad] = { .c = { 0x32, 0x75 }, .l1 = 5, .l = 11 },
+	[0x0ae] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0af] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b0] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b1] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b2] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b3] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b4] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b5] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b6] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b7] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b8] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0b9] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0ba] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0bb] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0bc] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0bd] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0be] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0bf] = { .c = { 0x32, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0c0] = { .c = { 0x61, 0x30 }, .l1 = 5, .l = 10 },
+	[0x0c1] = { .c = { 0x61, 0x30 }, .l1 = 5, .l = 10 },
+	[0x0c2] = { .c = { 0x61, 0x31 }, .l1 = 5, .l = 10 },
+	[0x0c3] = { .c = { 0x61, 0x31 }, .l1 = 5, .l = 10 },
+	[0x0c4] = { .c = { 0x61, 0x32 }, .l1 = 5, .l = 10 },
+	[0x0c5] = { .c = { 0x61, 0x32 }, .l1 = 5, .l = 10 },
+	[0x0c6] = { .c = { 0x61, 0x61 }, .l1 = 5, .l = 10 },
+	[0x0c7] = { .c = { 0x61, 0x61 }, .l1 = 5, .l = 10 },
+	[0x0c8] = { .c = { 0x61, 0x63 }, .l1 = 5, .l = 10 },
+	[0x0c9] = { .c = { 0x61, 0x63 }, .l1 = 5, .l = 10 },
+	[0x0ca] = { .c = { 0x61, 0x65 }, .l1 = 5, .l = 10 },
+	[0x0cb] = { .c = { 0x61, 0x65 }, .l1 = 5, .l = 10 },
+	[0x0cc] = { .c = { 0x61, 0x69 }, .l1 = 5, .l = 10 },
+	[0x0cd] = { .c = { 0x61, 0x69 }, .l1 = 5, .l = 10 },
+	[0x0ce] = { .c = { 0x61, 0x6f }, .l1 = 5, .l = 10 },
+	[0x0cf] = { .c = { 0x61, 0x6f }, .l1 = 5, .l = 10 },
+	[0x0d0] = { .c = { 0x61, 0x73 }, .l1 = 5, .l = 10 },
+	[0x0d1] = { .c = { 0x61, 0x73 }, .l1 = 5, .l = 10 },
+	[0x0d2] = { .c = { 0x61, 0x74 }, .l1 = 5, .l = 10 },
+	[0x0d3] = { .c = { 0x61, 0x74 }, .l1 = 5, .l = 10 },
+	[0x0d4] = { .c = { 0x61, 0x20 }, .l1 = 5, .l = 11 },
+	[0x0d5] = { .c = { 0x61, 0x25 }, .l1 = 5, .l = 11 },
+	[0x0d6] = { .c = { 0x61, 0x2d }, .l1 = 5, .l = 11 },
+	[0x0d7] = { .c = { 0x61, 0x2e }, .l1 = 5, .l = 11 },
+	[0x0d8] = { .c = { 0x61, 0x2f }, .l1 = 5, .l = 11 },
+	[0x0d9] = { .c = { 0x61, 0x33 }, .l1 = 5, .l = 11 },
+	[0x0da] = { .c = { 0x61, 0x34 }, .l1 = 5, .l = 11 },
+	[0x0db] = { .c = { 0x61, 0x35 }, .l1 = 5, .l = 11 },
+	[0x0dc] = { .c = { 0x61, 0x36 }, .l1 = 5, .l = 11 },
+	[0x0dd] = { .c = { 0x61, 0x37 }, .l1 = 5, .l = 11 },
+	[0x0de] = { .c = { 0x61, 0x38 }, .l1 = 5, .l = 11 },
+	[0x0df] = { .c = { 0x61, 0x39 }, .l1 = 5, .l = 11 },
+	[0x0e0] = { .c = { 0x61, 0x3d }, .l1 = 5, .l = 11 },
+	[0x0e1] = { .c = { 0x61, 0x41 }, .l1 = 5, .l = 11 },
+	[0x0e2] = { .c = { 0x61, 0x5f }, .l1 = 5, .l = 11 },
+	[0x0e3] = { .c = { 0x61, 0x62 }, .l1 = 5, .l = 11 },
+	[0x0e4] = { .c = { 0x61, 0x64 }, .l1 = 5, .l = 11 },
+	[0x0e5] = { .c = { 0x61, 0x66 }, .l1 = 5, .l = 11 },
+	[0x0e6] = { .c = { 0x61, 0x67 }, .l1 = 5, .l = 11 },
+	[0x0e7] = { .c = { 0x61, 0x68 }, .l1 = 5, .l = 11 },
+	[0x0e8] = { .c = { 0x61, 0x6c }, .l1 = 5, .l = 11 },
+	[0x0e9] = { .c = { 0x61, 0x6d }, .l1 = 5, .l = 11 },
+	[0x0ea] = { .c = { 0x61, 0x6e }, .l1 = 5, .l = 11 },
+	[0x0eb] = { .c = { 0x61, 0x70 }, .l1 = 5, .l = 11 },
+	[0x0ec] = { .c = { 0x61, 0x72 }, .l1 = 5, .l = 11 },
+	[0x0ed] = { .c = { 0x61, 0x75 }, .l1 = 5, .l = 11 },
+	[0x0ee] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0ef] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f0] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f1] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f2] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f3] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f4] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f5] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f6] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f7] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f8] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0f9] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0fa] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0fb] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0fc] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0fd] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0fe] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x0ff] = { .c = { 0x61, 0x00 }, .l1 = 5, .l = 5 },
+	[0x100] = { .c = { 0x63, 0x30 }, .l1 = 5, .l = 10 },
+	[0x101] = { .c = { 0x63, 0x30 }, .l1 = 5, .l = 10 },
+	[0x102] = { .c = { 0x63, 0x31 }, .l1 = 5, .l = 10 },
+	[0x103] = { .c = { 0x63, 0x31 }, .l1 = 5, .l = 10 },
+	[0x104] = { .c = { 0x63, 0x32 }, .l1 = 5, .l = 10 },
+	[0x105] = { .c = { 0x63, 0x32 }, .l1 = 5, .l = 10 },
+	[0x106] = { .c = { 0x63, 0x61 }, .l1 = 5, .l = 10 },
+	[0x107] = { .c = { 0x63, 0x61 }, .l1 = 5, .l = 10 },
+	[0x108] = { .c = { 0x63, 0x63 }, .l1 = 5, .l = 10 },
+	[0x109] = { .c = { 0x63, 0x63 }, .l1 = 5, .l = 10 },
+	[0x10a] = { .c = { 0x63, 0x65 }, .l1 = 5, .l = 10 },
+	[0x10b] = { .c = { 0x63, 0x65 }, .l1 = 5, .l = 10 },
+	[0x10c] = { .c = { 0x63, 0x69 }, .l1 = 5, .l = 10 },
+	[0x10d] = { .c = { 0x63, 0x69 }, .l1 = 5, .l = 10 },
+	[0x10e] = { .c = { 0x63, 0x6f }, .l1 = 5, .l = 10 },
+	[0x10f] = { .c = { 0x63, 0x6f }, .l1 = 5, .l = 10 },
+	[0x110] = { .c = { 0x63, 0x73 }, .l1 = 5, .l = 10 },
+	[0x111] = { .c = { 0x63, 0x73 }, .l1 = 5, .l = 10 },
+	[0x112] = { .c = { 0x63, 0x74 }, .l1 = 5, .l = 10 },
+	[0x113] = { .c = { 0x63, 0x74 }, .l1 = 5, .l = 10 },
+	[0x114] = { .c = { 0x63, 0x20 }, .l1 = 5, .l = 11 },
+	[0x115] = { .c = { 0x63, 0x25 }, .l1 = 5, .l = 11 },
+	[0x116] = { .c = { 0x63, 0x2d }, .l1 = 5, .l = 11 },
+	[0x117] = { .c = { 0x63, 0x2e }, .l1 = 5, .l = 11 },
+	[0x118] = { .c = { 0x63, 0x2f }, .l1 = 5, .l = 11 },
+	[0x119] = { .c = { 0x63, 0x33 }, .l1 = 5, .l = 11 },
+	[0x11a] = { .c = { 0x63, 0x34 }, .l1 = 5, .l = 11 },
+	[0x11b] = { .c = { 0x63, 0x35 }, .l1 = 5, .l = 11 },
+	[0x11c] = { .c = { 0x63, 0x36 }, .l1 = 5, .l = 11 },
+	[0x11d] = { .c = { 0x63, 0x37 }, .l1 = 5, .l = 11 },
+	[0x11e] = { .c = { 0x63, 0x38 }, .l1 = 5, .l = 11 },
+	[0x11f] = { .c = { 0x63, 0x39 }, .l1 = 5, .l = 11 },
+	[0x120] = { .c = { 0x63, 0x3d }, .l1 = 5, .l = 11 },
+	[0x121] = { .c = { 0x63, 0x41 }, .l1 = 5, .l = 11 },
+	[0x122] = { .c = { 0x63, 0x5f }, .l1 = 5, .l = 11 },
+	[0x123] = { .c = { 0x63, 0x62 }, .l1 = 5, .l = 11 },
+	[0x124] = { .c = { 0x63, 0x64 }, .l1 = 5, .l = 11 },
+	[0x125] = { .c = { 0x63, 0x66 }, .l1 = 5, .l = 11 },
+	[0x126] = { .c = { 0x63, 0x67 }, .l1 = 5, .l = 11 },
+	[0x127] = { .c = { 0x63, 0x68 }, .l1 = 5, .l = 11 },
+	[0x128] = { .c = { 0x63, 0x6c }, .l1 = 5, .l = 11 },
+	[0x129] = { .c = { 0x63, 0x6d }, .l1 = 5, .l = 11 },
+	[0x12a] = { .c = { 0x63, 0x6e }, .l1 = 5, .l = 11 },
+	[0x12b] = { .c = { 0x63, 0x70 }, .l1 = 5, .l = 11 },
+	[0x12c] = { .c = { 0x63, 0x72 }, .l1 = 5, .l = 11 },
+	[0x12d] = { .c = { 0x63, 0x75 }, .l1 = 5, .l = 11 },
+	[0x12e] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x12f] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x130] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x131] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x132] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x133] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x134] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x135] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x136] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x137] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x138] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x139] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x13a] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x13b] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x13c] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x13d] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x13e] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x13f] = { .c = { 0x63, 0x00 }, .l1 = 5, .l = 5 },
+	[0x140] = { .c = { 0x65, 0x30 }, .l1 = 5, .l = 10 },
+	[0x141] = { .c = { 0x65, 0x30 }, .l1 = 5, .l = 10 },
+	[0x142] = { .c = { 0x65, 0x31 }, .l1 = 5, .l = 10 },
+	[0x143] = { .c = { 0x65, 0x31 }, .l1 = 5, .l = 10 },
+	[0x144] = { .c = { 0x65, 0x32 }, .l1 = 5, .l = 10 },
+	[0x145] = { .c = { 0x65, 0x32 }, .l1 = 5, .l = 10 },
+	[0x146] = { .c = { 0x65, 0x61 }, .l1 = 5, .l = 10 },
+	[0x147] = { .c = { 0x65, 0x61 }, .l1 = 5, .l = 10 },
+	[0x148] = { .c = { 0x65, 0x63 }, .l1 = 5, .l = 10 },
+	[0x149] = { .c = { 0x65, 0x63 }, .l1 = 5, .l = 10 },
+	[0x14a] = { .c = { 0x65, 0x65 }, .l1 = 5, .l = 10 },
+	[0x14b] = { .c = { 0x65, 0x65 }, .l1 = 5, .l = 10 },
+	[0x14c] = { .c = { 0x65, 0x69 }, .l1 = 5, .l = 10 },
+	[0x14d] = { .c = { 0x65, 0x69 }, .l1 = 5, .l = 10 },
+	[0x14e] = { .c = { 0x65, 0x6f }, .l1 = 5, .l = 10 },
+	[0x14f] = { .c = { 0x65, 0x6f }, .l1 = 5, .l = 10 },
+	[0x150] = { .c = { 0x65, 0x73 }, .l1 = 5, .l = 10 },
+	[0x151] = { .c = { 0x65, 0x73 }, .l1 = 5, .l = 10 },
+	[0x152] = { .c = { 0x65, 0x74 }, .l1 = 5, .l = 10 },
+	[0x153] = { .c = { 0x65, 0x74 }, .l1 = 5, .l = 10 },
+	[0x154] = { .c = { 0x65, 0x20 }, .l1 = 5, .l = 11 },
+	[0x155] = { .c = { 0x65, 0x25 }, .l1 = 5, .l = 11 },
+	[0x156] = { .c = { 0x65, 0x2d }, .l1 = 5, .l = 11 },
+	[0x157] = { .c = { 0x65, 0x2e }, .l1 = 5, .l = 11 },
+	[0x158] = { .c = { 0x65, 0x2f }, .l1 = 5, .l = 11 },
+	[0x159] = { .c = { 0x65, 0x33 }, .l1 = 5, .l = 11 },
+	[0x15a] = { .c = { 0x65, 0x34 }, .l1 = 5, .l = 11 },
+	[0x15b] = { .c = { 0x65, 0x35 }, .l1 = 5, .l = 11 },
+	[0x15c] = { .c = { 0x65, 0x36 }, .l1 = 5, .l = 11 },
+	[0x15d] = { .c = { 0x65, 0x37 }, .l1 = 5, .l = 11 },
+	[0x15e] = { .c = { 0x65, 0x38 }, .l1 = 5, .l = 11 },
+	[0x15f] = { .c = { 0x65, 0x39 }, .l1 = 5, .l = 11 },
+	[0x160] = { .c = { 0x65, 0x3d }, .l1 = 5, .l = 11 },
+	[0x161] = { .c = { 0x65, 0x41 }, .l1 = 5, .l = 11 },
+	[0x162] = { .c = { 0x65, 0x5f }, .l1 = 5, .l = 11 },
+	[0x163] = { .c = { 0x65, 0x62 }, .l1 = 5, .l = 11 },
+	[0x164] = { .c = { 0x65, 0x64 }, .l1 = 5, .l = 11 },
+	[0x165] = { .c = { 0x65, 0x66 }, .l1 = 5, .l = 11 },
+	[0x166] = { .c = { 0x65, 0x67 }, .l1 = 5, .l = 11 },
+	[0x167] = { .c = { 0x65, 0x68 }, .l1 = 5, .l = 11 },
+	[0x168] = { .c = { 0x65, 0x6c }, .l1 = 5, .l = 11 },
+	[0x169] = { .c = { 0x65, 0x6d }, .l1 = 5, .l = 11 },
+	[0x16a] = { .c = { 0x65, 0x6e }, .l1 = 5, .l = 11 },
+	[0x16b] = { .c = { 0x65, 0x70 }, .l1 = 5, .l = 11 },
+	[0x16c] = { .c = { 0x65, 0x72 }, .l1 = 5, .l = 11 },
+	[0x16d] = { .c = { 0x65, 0x75 }, .l1 = 5, .l = 11 },
+	[0x16e] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x16f] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x170] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x171] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x172] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x173] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x174] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x175] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x176] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x177] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x178] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x179] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x17a] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x17b] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x17c] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x17d] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x17e] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x17f] = { .c = { 0x65, 0x00 }, .l1 = 5, .l = 5 },
+	[0x180] = { .c = { 0x69, 0x30 }, .l1 = 5, .l = 10 },
+	[0x181] = { .c = { 0x69, 0x30 }, .l1 = 5, .l = 10 },
+	[0x182] = { .c = { 0x69, 0x31 }, .l1 = 5, .l = 10 },
+	[0x183] = { .c = { 0x69, 0x31 }, .l1 = 5, .l = 10 },
+	[0x184] = { .c = { 0x69, 0x32 }, .l1 = 5, .l = 10 },
+	[0x185] = { .c = { 0x69, 0x32 }, .l1 = 5, .l = 10 },
+	[0x186] = { .c = { 0x69, 0x61 }, .l1 = 5, .l = 10 },
+	[0x187] = { .c = { 0x69, 0x61 }, .l1 = 5, .l = 10 },
+	[0x188] = { .c = { 0x69, 0x63 }, .l1 = 5, .l = 10 },
+	[0x189] = { .c = { 0x69, 0x63 }, .l1 = 5, .l = 10 },
+	[0x18a] = { .c = { 0x69, 0x65 }, .l1 = 5, .l = 10 },
+	[0x18b] = { .c = { 0x69, 0x65 }, .l1 = 5, .l = 10 },
+	[0x18c] = { .c = { 0x69, 0x69 }, .l1 = 5, .l = 10 },
+	[0x18d] = { .c = { 0x69, 0x69 }, .l1 = 5, .l = 10 },
+	[0x18e] = { .c = { 0x69, 0x6f }, .l1 = 5, .l = 10 },
+	[0x18f] = { .c = { 0x69, 0x6f }, .l1 = 5, .l = 10 },
+	[0x190] = { .c = { 0x69, 0x73 }, .l1 = 5, .l = 10 },
+	[0x191] = { .c = { 0x69, 0x73 }, .l1 = 5, .l = 10 },
+	[0x192] = { .c = { 0x69, 0x74 }, .l1 = 5, .l = 10 },
+	[0x193] = { .c = { 0x69, 0x74 }, .l1 = 5, .l = 10 },
+	[0x194] = { .c = { 0x69, 0x20 }, .l1 = 5, .l = 11 },
+	[0x195] = { .c = { 0x69, 0x25 }, .l1 = 5, .l = 11 },
+	[0x196] = { .c = { 0x69, 0x2d }, .l1 = 5, .l = 11 },
+	[0x197] = { .c = { 0x69, 0x2e }, .l1 = 5, .l = 11 },
+	[0x198] = { .c = { 0x69, 0x2f }, .l1 = 5, .l = 11 },
+	[0x199] = { .c = { 0x69, 0x33 }, .l1 = 5, .l = 11 },
+	[0x19a] = { .c = { 0x69, 0x34 }, .l1 = 5, .l = 11 },
+	[0x19b] = { .c = { 0x69, 0x35 }, .l1 = 5, .l = 11 },
+	[0x19c] = { .c = { 0x69, 0x36 }, .l1 = 5, .l = 11 },
+	[0x19d] = { .c = { 0x69, 0x37 }, .l1 = 5, .l = 11 },
+	[0x19e] = { .c = { 0x69, 0x38 }, .l1 = 5, .l = 11 },
+	[0x19f] = { .c = { 0x69, 0x39 }, .l1 = 5, .l = 11 },
+	[0x1a0] = { .c = { 0x69, 0x3d }, .l1 = 5, .l = 11 },
+	[0x1a1] = { .c = { 0x69, 0x41 }, .l1 = 5, .l = 11 },
+	[0x1a2] = { .c = { 0x69, 0x5f }, .l1 = 5, .l = 11 },
+	[0x1a3] = { .c = { 0x69, 0x62 }, .l1 = 5, .l = 11 },
+	[0x1a4] = { .c = { 0x69, 0x64 }, .l1 = 5, .l = 11 },
+	[0x1a5] = { .c = { 0x69, 0x66 }, .l1 = 5, .l = 11 },
+	[0x1a6] = { .c = { 0x69, 0x67 }, .l1 = 5, .l = 11 },
+	[0x1a7] = { .c = { 0x69, 0x68 }, .l1 = 5, .l = 11 },
+	[0x1a8] = { .c = { 0x69, 0x6c }, .l1 = 5, .l = 11 },
+	[0x1a9] = { .c = { 0x69, 0x6d }, .l1 = 5, .l = 11 },
+	[0x1aa] = { .c = { 0x69, 0x6e }, .l1 = 5, .l = 11 },
+	[0x1ab] = { .c = { 0x69, 0x70 }, .l1 = 5, .l = 11 },
+	[0x1ac] = { .c = { 0x69, 0x72 }, .l1 = 5, .l = 11 },
+	[0x1ad] = { .c = { 0x69, 0x75 }, .l1 = 5, .l = 11 },
+	[0x1ae] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1af] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b0] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b1] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b2] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b3] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b4] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b5] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b6] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b7] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b8] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1b9] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1ba] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1bb] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1bc] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1bd] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1be] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1bf] = { .c = { 0x69, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1c0] = { .c = { 0x6f, 0x30 }, .l1 = 5, .l = 10 },
+	[0x1c1] = { .c = { 0x6f, 0x30 }, .l1 = 5, .l = 10 },
+	[0x1c2] = { .c = { 0x6f, 0x31 }, .l1 = 5, .l = 10 },
+	[0x1c3] = { .c = { 0x6f, 0x31 }, .l1 = 5, .l = 10 },
+	[0x1c4] = { .c = { 0x6f, 0x32 }, .l1 = 5, .l = 10 },
+	[0x1c5] = { .c = { 0x6f, 0x32 }, .l1 = 5, .l = 10 },
+	[0x1c6] = { .c = { 0x6f, 0x61 }, .l1 = 5, .l = 10 },
+	[0x1c7] = { .c = { 0x6f, 0x61 }, .l1 = 5, .l = 10 },
+	[0x1c8] = { .c = { 0x6f, 0x63 }, .l1 = 5, .l = 10 },
+	[0x1c9] = { .c = { 0x6f, 0x63 }, .l1 = 5, .l = 10 },
+	[0x1ca] = { .c = { 0x6f, 0x65 }, .l1 = 5, .l = 10 },
+	[0x1cb] = { .c = { 0x6f, 0x65 }, .l1 = 5, .l = 10 },
+	[0x1cc] = { .c = { 0x6f, 0x69 }, .l1 = 5, .l = 10 },
+	[0x1cd] = { .c = { 0x6f, 0x69 }, .l1 = 5, .l = 10 },
+	[0x1ce] = { .c = { 0x6f, 0x6f }, .l1 = 5, .l = 10 },
+	[0x1cf] = { .c = { 0x6f, 0x6f }, .l1 = 5, .l = 10 },
+	[0x1d0] = { .c = { 0x6f, 0x73 }, .l1 = 5, .l = 10 },
+	[0x1d1] = { .c = { 0x6f, 0x73 }, .l1 = 5, .l = 10 },
+	[0x1d2] = { .c = { 0x6f, 0x74 }, .l1 = 5, .l = 10 },
+	[0x1d3] = { .c = { 0x6f, 0x74 }, .l1 = 5, .l = 10 },
+	[0x1d4] = { .c = { 0x6f, 0x20 }, .l1 = 5, .l = 11 },
+	[0x1d5] = { .c = { 0x6f, 0x25 }, .l1 = 5, .l = 11 },
+	[0x1d6] = { .c = { 0x6f, 0x2d }, .l1 = 5, .l = 11 },
+	[0x1d7] = { .c = { 0x6f, 0x2e }, .l1 = 5, .l = 11 },
+	[0x1d8] = { .c = { 0x6f, 0x2f }, .l1 = 5, .l = 11 },
+	[0x1d9] = { .c = { 0x6f, 0x33 }, .l1 = 5, .l = 11 },
+	[0x1da] = { .c = { 0x6f, 0x34 }, .l1 = 5, .l = 11 },
+	[0x1db] = { .c = { 0x6f, 0x35 }, .l1 = 5, .l = 11 },
+	[0x1dc] = { .c = { 0x6f, 0x36 }, .l1 = 5, .l = 11 },
+	[0x1dd] = { .c = { 0x6f, 0x37 }, .l1 = 5, .l = 11 },
+	[0x1de] = { .c = { 0x6f, 0x38 }, .l1 = 5, .l = 11 },
+	[0x1df] = { .c = { 0x6f, 0x39 }, .l1 = 5, .l = 11 },
+	[0x1e0] = { .c = { 0x6f, 0x3d }, .l1 = 5, .l = 11 },
+	[0x1e1] = { .c = { 0x6f, 0x41 }, .l1 = 5, .l = 11 },
+	[0x1e2] = { .c = { 0x6f, 0x5f }, .l1 = 5, .l = 11 },
+	[0x1e3] = { .c = { 0x6f, 0x62 }, .l1 = 5, .l = 11 },
+	[0x1e4] = { .c = { 0x6f, 0x64 }, .l1 = 5, .l = 11 },
+	[0x1e5] = { .c = { 0x6f, 0x66 }, .l1 = 5, .l = 11 },
+	[0x1e6] = { .c = { 0x6f, 0x67 }, .l1 = 5, .l = 11 },
+	[0x1e7] = { .c = { 0x6f, 0x68 }, .l1 = 5, .l = 11 },
+	[0x1e8] = { .c = { 0x6f, 0x6c }, .l1 = 5, .l = 11 },
+	[0x1e9] = { .c = { 0x6f, 0x6d }, .l1 = 5, .l = 11 },
+	[0x1ea] = { .c = { 0x6f, 0x6e }, .l1 = 5, .l = 11 },
+	[0x1eb] = { .c = { 0x6f, 0x70 }, .l1 = 5, .l = 11 },
+	[0x1ec] = { .c = { 0x6f, 0x72 }, .l1 = 5, .l = 11 },
+	[0x1ed] = { .c = { 0x6f, 0x75 }, .l1 = 5, .l = 11 },
+	[0x1ee] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1ef] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f0] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f1] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f2] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f3] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f4] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f5] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f6] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f7] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f8] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1f9] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1fa] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1fb] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1fc] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1fd] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1fe] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x1ff] = { .c = { 0x6f, 0x00 }, .l1 = 5, .l = 5 },
+	[0x200] = { .c = { 0x73, 0x30 }, .l1 = 5, .l = 10 },
+	[0x201] = { .c = { 0x73, 0x30 }, .l1 = 5, .l = 10 },
+	[0x202] = { .c = { 0x73, 0x31 }, .l1 = 5, .l = 10 },
+	[0x203] = { .c = { 0x73, 0x31 }, .l1 = 5, .l = 10 },
+	[0x204] = { .c = { 0x73, 0x32 }, .l1 = 5, .l = 10 },
+	[0x205] = { .c = { 0x73, 0x32 }, .l1 = 5, .l = 10 },
+	[0x206] = { .c = { 0x73, 0x61 }, .l1 = 5, .l = 10 },
+	[0x207] = { .c = { 0x73, 0x61 }, .l1 = 5, .l = 10 },
+	[0x208] = { .c = { 0x73, 0x63 }, .l1 = 5, .l = 10 },
+	[0x209] = { .c = { 0x73, 0x63 }, .l1 = 5, .l = 10 },
+	[0x20a] = { .c = { 0x73, 0x65 }, .l1 = 5, .l = 10 },
+	[0x20b] = { .c = { 0x73, 0x65 }, .l1 = 5, .l = 10 },
+	[0x20c] = { .c = { 0x73, 0x69 }, .l1 = 5, .l = 10 },
+	[0x20d] = { .c = { 0x73, 0x69 }, .l1 = 5, .l = 10 },
+	[0x20e] = { .c = { 0x73, 0x6f }, .l1 = 5, .l = 10 },
+	[0x20f] = { .c = { 0x73, 0x6f }, .l1 = 5, .l = 10 },
+	[0x210] = { .c = { 0x73, 0x73 }, .l1 = 5, .l = 10 },
+	[0x211] = { .c = { 0x73, 0x73 }, .l1 = 5, .l = 10 },
+	[0x212] = { .c = { 0x73, 0x74 }, .l1 = 5, .l = 10 },
+	[0x213] = { .c = { 0x73, 0x74 }, .l1 = 5, .l = 10 },
+	[0x214] = { .c = { 0x73, 0x20 }, .l1 = 5, .l = 11 },
+	[0x215] = { .c = { 0x73, 0x25 }, .l1 = 5, .l = 11 },
+	[0x216] = { .c = { 0x73, 0x2d }, .l1 = 5, .l = 11 },
+	[0x217] = { .c = { 0x73, 0x2e }, .l1 = 5, .l = 11 },
+	[0x218] = { .c = { 0x73, 0x2f }, .l1 = 5, .l = 11 },
+	[0x219] = { .c = { 0x73, 0x33 }, .l1 = 5, .l = 11 },
+	[0x21a] = { .c = { 0x73, 0x34 }, .l1 = 5, .l = 11 },
+	[0x21b] = { .c = { 0x73, 0x35 }, .l1 = 5, .l = 11 },
+	[0x21c] = { .c = { 0x73, 0x36 }, .l1 = 5, .l = 11 },
+	[0x21d] = { .c = { 0x73, 0x37 }, .l1 = 5, .l = 11 },
+	[0x21e] = { .c = { 0x73, 0x38 }, .l1 = 5, .l = 11 },
+	[0x21f] = { .c = { 0x73, 0x39 }, .l1 = 5, .l = 11 },
+	[0x220] = { .c = { 0x73, 0x3d }, .l1 = 5, .l = 11 },
+	[0x221] = { .c = { 0x73, 0x41 }, .l1 = 5, .l = 11 },
+	[0x222] = { .c = { 0x73, 0x5f }, .l1 = 5, .l = 11 },
+	[0x223] = { .c = { 0x73, 0x62 }, .l1 = 5, .l = 11 },
+	[0x224] = { .c = { 0x73, 0x64 }, .l1 = 5, .l = 11 },
+	[0x225] = { .c = { 0x73, 0x66 }, .l1 = 5, .l = 11 },
+	[0x226] = { .c = { 0x73, 0x67 }, .l1 = 5, .l = 11 },
+	[0x227] = { .c = { 0x73, 0x68 }, .l1 = 5, .l = 11 },
+	[0x228] = { .c = { 0x73, 0x6c }, .l1 = 5, .l = 11 },
+	[0x229] = { .c = { 0x73, 0x6d }, .l1 = 5, .l = 11 },
+	[0x22a] = { .c = { 0x73, 0x6e }, .l1 = 5, .l = 11 },
+	[0x22b] = { .c = { 0x73, 0x70 }, .l1 = 5, .l = 11 },
+	[0x22c] = { .c = { 0x73, 0x72 }, .l1 = 5, .l = 11 },
+	[0x22d] = { .c = { 0x73, 0x75 }, .l1 = 5, .l = 11 },
+	[0x22e] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x22f] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x230] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x231] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x232] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x233] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x234] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x235] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x236] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x237] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x238] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x239] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x23a] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x23b] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x23c] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x23d] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x23e] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x23f] = { .c = { 0x73, 0x00 }, .l1 = 5, .l = 5 },
+	[0x240] = { .c = { 0x74, 0x30 }, .l1 = 5, .l = 10 },
+	[0x241] = { .c = { 0x74, 0x30 }, .l1 = 5, .l = 10 },
+	[0x242] = { .c = { 0x74, 0x31 }, .l1 = 5, .l = 10 },
+	[0x243] = { .c = { 0x74, 0x31 }, .l1 = 5, .l = 10 },
+	[0x244] = { .c = { 0x74, 0x32 }, .l1 = 5, .l = 10 },
+	[0x245] = { .c = { 0x74, 0x32 }, .l1 = 5, .l = 10 },
+	[0x246] = { .c = { 0x74, 0x61 }, .l1 = 5, .l = 10 },
+	[0x247] = { .c = { 0x74, 0x61 }, .l1 = 5, .l = 10 },
+	[0x248] = { .c = { 0x74, 0x63 }, .l1 = 5, .l = 10 },
+	[0x249] = { .c = { 0x74, 0x63 }, .l1 = 5, .l = 10 },
+	[0x24a] = { .c = { 0x74, 0x65 }, .l1 = 5, .l = 10 },
+	[0x24b] = { .c = { 0x74, 0x65 }, .l1 = 5, .l = 10 },
+	[0x24c] = { .c = { 0x74, 0x69 }, .l1 = 5, .l = 10 },
+	[0x24d] = { .c = { 0x74, 0x69 }, .l1 = 5, .l = 10 },
+	[0x24e] = { .c = { 0x74, 0x6f }, .l1 = 5, .l = 10 },
+	[0x24f] = { .c = { 0x74, 0x6f }, .l1 = 5, .l = 10 },
+	[0x250] = { .c = { 0x74, 0x73 }, .l1 = 5, .l = 10 },
+	[0x251] = { .c = { 0x74, 0x73 }, .l1 = 5, .l = 10 },
+	[0x252] = { .c = { 0x74, 0x74 }, .l1 = 5, .l = 10 },
+	[0x253] = { .c = { 0x74, 0x74 }, .l1 = 5, .l = 10 },
+	[0x254] = { .c = { 0x74, 0x20 }, .l1 = 5, .l = 11 },
+	[0x255] = { .c = { 0x74, 0x25 }, .l1 = 5, .l = 11 },
+	[0x256] = { .c = { 0x74, 0x2d }, .l1 = 5, .l = 11 },
+	[0x257] = { .c = { 0x74, 0x2e }, .l1 = 5, .l = 11 },
+	[0x258] = { .c = { 0x74, 0x2f }, .l1 = 5, .l = 11 },
+	[0x259] = { .c = { 0x74, 0x33 }, .l1 = 5, .l = 11 },
+	[0x25a] = { .c = { 0x74, 0x34 }, .l1 = 5, .l = 11 },
+	[0x25b] = { .c = { 0x74, 0x35 }, .l1 = 5, .l = 11 },
+	[0x25c] = { .c = { 0x74, 0x36 }, .l1 = 5, .l = 11 },
+	[0x25d] = { .c = { 0x74, 0x37 }, .l1 = 5, .l = 11 },
+	[0x25e] = { .c = { 0x74, 0x38 }, .l1 = 5, .l = 11 },
+	[0x25f] = { .c = { 0x74, 0x39 }, .l1 = 5, .l = 11 },
+	[0x260] = { .c = { 0x74, 0x3d }, .l1 = 5, .l = 11 },
+	[0x261] = { .c = { 0x74, 0x41 }, .l1 = 5, .l = 11 },
+	[0x262] = { .c = { 0x74, 0x5f }, .l1 = 5, .l = 11 },
+	[0x263] = { .c = { 0x74, 0x62 }, .l1 = 5, .l = 11 },
+	[0x264] = { .c = { 0x74, 0x64 }, .l1 = 5, .l = 11 },
+	[0x265] = { .c = { 0x74, 0x66 }, .l1 = 5, .l = 11 },
+	[0x266] = { .c = { 0x74, 0x67 }, .l1 = 5, .l = 11 },
+	[0x267] = { .c = { 0x74, 0x68 }, .l1 = 5, .l = 11 },
+	[0x268] = { .c = { 0x74, 0x6c }, .l1 = 5, .l = 11 },
+	[0x269] = { .c = { 0x74, 0x6d }, .l1 = 5, .l = 11 },
+	[0x26a] = { .c = { 0x74, 0x6e }, .l1 = 5, .l = 11 },
+	[0x26b] = { .c = { 0x74, 0x70 }, .l1 = 5, .l = 11 },
+	[0x26c] = { .c = { 0x74, 0x72 }, .l1 = 5, .l = 11 },
+	[0x26d] = { .c = { 0x74, 0x75 }, .l1 = 5, .l = 11 },
+	[0x26e] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x26f] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x270] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x271] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x272] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x273] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x274] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x275] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x276] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x277] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x278] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x279] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x27a] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x27b] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x27c] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x27d] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x27e] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x27f] = { .c = { 0x74, 0x00 }, .l1 = 5, .l = 5 },
+	[0x280] = { .c = { 0x20, 0x30 }, .l1 = 6, .l = 11 },
+	[0x281] = { .c = { 0x20, 0x31 }, .l1 = 6, .l = 11 },
+	[0x282] = { .c = { 0x20, 0x32 }, .l1 = 6, .l = 11 },
+	[0x283] = { .c = { 0x20, 0x61 }, .l1 = 6, .l = 11 },
+	[0x284] = { .c = { 0x20, 0x63 }, .l1 = 6, .l = 11 },
+	[0x285] = { .c = { 0x20, 0x65 }, .l1 = 6, .l = 11 },
+	[0x286] = { .c = { 0x20, 0x69 }, .l1 = 6, .l = 11 },
+	[0x287] = { .c = { 0x20, 0x6f }, .l1 = 6, .l = 11 },
+	[0x288] = { .c = { 0x20, 0x73 }, .l1 = 6, .l = 11 },
+	[0x289] = { .c = { 0x20, 0x74 }, .l1 = 6, .l = 11 },
+	[0x28a] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x28b] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x28c] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x28d] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x28e] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x28f] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x290] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x291] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x292] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x293] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x294] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x295] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x296] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x297] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x298] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x299] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x29a] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x29b] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x29c] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x29d] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x29e] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x29f] = { .c = { 0x20, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2a0] = { .c = { 0x25, 0x30 }, .l1 = 6, .l = 11 },
+	[0x2a1] = { .c = { 0x25, 0x31 }, .l1 = 6, .l = 11 },
+	[0x2a2] = { .c = { 0x25, 0x32 }, .l1 = 6, .l = 11 },
+	[0x2a3] = { .c = { 0x25, 0x61 }, .l1 = 6, .l = 11 },
+	[0x2a4] = { .c = { 0x25, 0x63 }, .l1 = 6, .l = 11 },
+	[0x2a5] = { .c = { 0x25, 0x65 }, .l1 = 6, .l = 11 },
+	[0x2a6] = { .c = { 0x25, 0x69 }, .l1 = 6, .l = 11 },
+	[0x2a7] = { .c = { 0x25, 0x6f }, .l1 = 6, .l = 11 },
+	[0x2a8] = { .c = { 0x25, 0x73 }, .l1 = 6, .l = 11 },
+	[0x2a9] = { .c = { 0x25, 0x74 }, .l1 = 6, .l = 11 },
+	[0x2aa] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ab] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ac] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ad] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ae] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2af] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b0] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b1] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b2] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b3] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b4] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b5] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b6] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b7] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b8] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2b9] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ba] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2bb] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2bc] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2bd] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2be] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2bf] = { .c = { 0x25, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2c0] = { .c = { 0x2d, 0x30 }, .l1 = 6, .l = 11 },
+	[0x2c1] = { .c = { 0x2d, 0x31 }, .l1 = 6, .l = 11 },
+	[0x2c2] = { .c = { 0x2d, 0x32 }, .l1 = 6, .l = 11 },
+	[0x2c3] = { .c = { 0x2d, 0x61 }, .l1 = 6, .l = 11 },
+	[0x2c4] = { .c = { 0x2d, 0x63 }, .l1 = 6, .l = 11 },
+	[0x2c5] = { .c = { 0x2d, 0x65 }, .l1 = 6, .l = 11 },
+	[0x2c6] = { .c = { 0x2d, 0x69 }, .l1 = 6, .l = 11 },
+	[0x2c7] = { .c = { 0x2d, 0x6f }, .l1 = 6, .l = 11 },
+	[0x2c8] = { .c = { 0x2d, 0x73 }, .l1 = 6, .l = 11 },
+	[0x2c9] = { .c = { 0x2d, 0x74 }, .l1 = 6, .l = 11 },
+	[0x2ca] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2cb] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2cc] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2cd] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ce] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2cf] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d0] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d1] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d2] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d3] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d4] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d5] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d6] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d7] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d8] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2d9] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2da] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2db] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2dc] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2dd] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2de] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2df] = { .c = { 0x2d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2e0] = { .c = { 0x2e, 0x30 }, .l1 = 6, .l = 11 },
+	[0x2e1] = { .c = { 0x2e, 0x31 }, .l1 = 6, .l = 11 },
+	[0x2e2] = { .c = { 0x2e, 0x32 }, .l1 = 6, .l = 11 },
+	[0x2e3] = { .c = { 0x2e, 0x61 }, .l1 = 6, .l = 11 },
+	[0x2e4] = { .c = { 0x2e, 0x63 }, .l1 = 6, .l = 11 },
+	[0x2e5] = { .c = { 0x2e, 0x65 }, .l1 = 6, .l = 11 },
+	[0x2e6] = { .c = { 0x2e, 0x69 }, .l1 = 6, .l = 11 },
+	[0x2e7] = { .c = { 0x2e, 0x6f }, .l1 = 6, .l = 11 },
+	[0x2e8] = { .c = { 0x2e, 0x73 }, .l1 = 6, .l = 11 },
+	[0x2e9] = { .c = { 0x2e, 0x74 }, .l1 = 6, .l = 11 },
+	[0x2ea] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2eb] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ec] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ed] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ee] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ef] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f0] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f1] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f2] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f3] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f4] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f5] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f6] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f7] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f8] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2f9] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2fa] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2fb] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2fc] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2fd] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2fe] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x2ff] = { .c = { 0x2e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x300] = { .c = { 0x2f, 0x30 }, .l1 = 6, .l = 11 },
+	[0x301] = { .c = { 0x2f, 0x31 }, .l1 = 6, .l = 11 },
+	[0x302] = { .c = { 0x2f, 0x32 }, .l1 = 6, .l = 11 },
+	[0x303] = { .c = { 0x2f, 0x61 }, .l1 = 6, .l = 11 },
+	[0x304] = { .c = { 0x2f, 0x63 }, .l1 = 6, .l = 11 },
+	[0x305] = { .c = { 0x2f, 0x65 }, .l1 = 6, .l = 11 },
+	[0x306] = { .c = { 0x2f, 0x69 }, .l1 = 6, .l = 11 },
+	[0x307] = { .c = { 0x2f, 0x6f }, .l1 = 6, .l = 11 },
+	[0x308] = { .c = { 0x2f, 0x73 }, .l1 = 6, .l = 11 },
+	[0x309] = { .c = { 0x2f, 0x74 }, .l1 = 6, .l = 11 },
+	[0x30a] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x30b] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x30c] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x30d] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x30e] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x30f] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x310] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x311] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x312] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x313] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x314] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x315] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x316] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x317] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x318] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x319] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x31a] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x31b] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x31c] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x31d] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x31e] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x31f] = { .c = { 0x2f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x320] = { .c = { 0x33, 0x30 }, .l1 = 6, .l = 11 },
+	[0x321] = { .c = { 0x33, 0x31 }, .l1 = 6, .l = 11 },
+	[0x322] = { .c = { 0x33, 0x32 }, .l1 = 6, .l = 11 },
+	[0x323] = { .c = { 0x33, 0x61 }, .l1 = 6, .l = 11 },
+	[0x324] = { .c = { 0x33, 0x63 }, .l1 = 6, .l = 11 },
+	[0x325] = { .c = { 0x33, 0x65 }, .l1 = 6, .l = 11 },
+	[0x326] = { .c = { 0x33, 0x69 }, .l1 = 6, .l = 11 },
+	[0x327] = { .c = { 0x33, 0x6f }, .l1 = 6, .l = 11 },
+	[0x328] = { .c = { 0x33, 0x73 }, .l1 = 6, .l = 11 },
+	[0x329] = { .c = { 0x33, 0x74 }, .l1 = 6, .l = 11 },
+	[0x32a] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x32b] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x32c] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x32d] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x32e] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x32f] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x330] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x331] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x332] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x333] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x334] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x335] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x336] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x337] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x338] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x339] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x33a] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x33b] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x33c] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x33d] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x33e] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x33f] = { .c = { 0x33, 0x00 }, .l1 = 6, .l = 6 },
+	[0x340] = { .c = { 0x34, 0x30 }, .l1 = 6, .l = 11 },
+	[0x341] = { .c = { 0x34, 0x31 }, .l1 = 6, .l = 11 },
+	[0x342] = { .c = { 0x34, 0x32 }, .l1 = 6, .l = 11 },
+	[0x343] = { .c = { 0x34, 0x61 }, .l1 = 6, .l = 11 },
+	[0x344] = { .c = { 0x34, 0x63 }, .l1 = 6, .l = 11 },
+	[0x345] = { .c = { 0x34, 0x65 }, .l1 = 6, .l = 11 },
+	[0x346] = { .c = { 0x34, 0x69 }, .l1 = 6, .l = 11 },
+	[0x347] = { .c = { 0x34, 0x6f }, .l1 = 6, .l = 11 },
+	[0x348] = { .c = { 0x34, 0x73 }, .l1 = 6, .l = 11 },
+	[0x349] = { .c = { 0x34, 0x74 }, .l1 = 6, .l = 11 },
+	[0x34a] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x34b] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x34c] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x34d] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x34e] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x34f] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x350] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x351] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x352] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x353] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x354] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x355] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x356] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x357] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x358] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x359] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x35a] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x35b] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x35c] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x35d] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x35e] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x35f] = { .c = { 0x34, 0x00 }, .l1 = 6, .l = 6 },
+	[0x360] = { .c = { 0x35, 0x30 }, .l1 = 6, .l = 11 },
+	[0x361] = { .c = { 0x35, 0x31 }, .l1 = 6, .l = 11 },
+	[0x362] = { .c = { 0x35, 0x32 }, .l1 = 6, .l = 11 },
+	[0x363] = { .c = { 0x35, 0x61 }, .l1 = 6, .l = 11 },
+	[0x364] = { .c = { 0x35, 0x63 }, .l1 = 6, .l = 11 },
+	[0x365] = { .c = { 0x35, 0x65 }, .l1 = 6, .l = 11 },
+	[0x366] = { .c = { 0x35, 0x69 }, .l1 = 6, .l = 11 },
+	[0x367] = { .c = { 0x35, 0x6f }, .l1 = 6, .l = 11 },
+	[0x368] = { .c = { 0x35, 0x73 }, .l1 = 6, .l = 11 },
+	[0x369] = { .c = { 0x35, 0x74 }, .l1 = 6, .l = 11 },
+	[0x36a] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x36b] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x36c] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x36d] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x36e] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x36f] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x370] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x371] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x372] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x373] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x374] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x375] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x376] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x377] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x378] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x379] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x37a] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x37b] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x37c] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x37d] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x37e] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x37f] = { .c = { 0x35, 0x00 }, .l1 = 6, .l = 6 },
+	[0x380] = { .c = { 0x36, 0x30 }, .l1 = 6, .l = 11 },
+	[0x381] = { .c = { 0x36, 0x31 }, .l1 = 6, .l = 11 },
+	[0x382] = { .c = { 0x36, 0x32 }, .l1 = 6, .l = 11 },
+	[0x383] = { .c = { 0x36, 0x61 }, .l1 = 6, .l = 11 },
+	[0x384] = { .c = { 0x36, 0x63 }, .l1 = 6, .l = 11 },
+	[0x385] = { .c = { 0x36, 0x65 }, .l1 = 6, .l = 11 },
+	[0x386] = { .c = { 0x36, 0x69 }, .l1 = 6, .l = 11 },
+	[0x387] = { .c = { 0x36, 0x6f }, .l1 = 6, .l = 11 },
+	[0x388] = { .c = { 0x36, 0x73 }, .l1 = 6, .l = 11 },
+	[0x389] = { .c = { 0x36, 0x74 }, .l1 = 6, .l = 11 },
+	[0x38a] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x38b] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x38c] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x38d] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x38e] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x38f] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x390] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x391] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x392] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x393] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x394] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x395] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x396] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x397] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x398] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x399] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x39a] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x39b] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x39c] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x39d] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x39e] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x39f] = { .c = { 0x36, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3a0] = { .c = { 0x37, 0x30 }, .l1 = 6, .l = 11 },
+	[0x3a1] = { .c = { 0x37, 0x31 }, .l1 = 6, .l = 11 },
+	[0x3a2] = { .c = { 0x37, 0x32 }, .l1 = 6, .l = 11 },
+	[0x3a3] = { .c = { 0x37, 0x61 }, .l1 = 6, .l = 11 },
+	[0x3a4] = { .c = { 0x37, 0x63 }, .l1 = 6, .l = 11 },
+	[0x3a5] = { .c = { 0x37, 0x65 }, .l1 = 6, .l = 11 },
+	[0x3a6] = { .c = { 0x37, 0x69 }, .l1 = 6, .l = 11 },
+	[0x3a7] = { .c = { 0x37, 0x6f }, .l1 = 6, .l = 11 },
+	[0x3a8] = { .c = { 0x37, 0x73 }, .l1 = 6, .l = 11 },
+	[0x3a9] = { .c = { 0x37, 0x74 }, .l1 = 6, .l = 11 },
+	[0x3aa] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ab] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ac] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ad] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ae] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3af] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b0] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b1] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b2] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b3] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b4] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b5] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b6] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b7] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b8] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3b9] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ba] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3bb] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3bc] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3bd] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3be] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3bf] = { .c = { 0x37, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3c0] = { .c = { 0x38, 0x30 }, .l1 = 6, .l = 11 },
+	[0x3c1] = { .c = { 0x38, 0x31 }, .l1 = 6, .l = 11 },
+	[0x3c2] = { .c = { 0x38, 0x32 }, .l1 = 6, .l = 11 },
+	[0x3c3] = { .c = { 0x38, 0x61 }, .l1 = 6, .l = 11 },
+	[0x3c4] = { .c = { 0x38, 0x63 }, .l1 = 6, .l = 11 },
+	[0x3c5] = { .c = { 0x38, 0x65 }, .l1 = 6, .l = 11 },
+	[0x3c6] = { .c = { 0x38, 0x69 }, .l1 = 6, .l = 11 },
+	[0x3c7] = { .c = { 0x38, 0x6f }, .l1 = 6, .l = 11 },
+	[0x3c8] = { .c = { 0x38, 0x73 }, .l1 = 6, .l = 11 },
+	[0x3c9] = { .c = { 0x38, 0x74 }, .l1 = 6, .l = 11 },
+	[0x3ca] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3cb] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3cc] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3cd] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ce] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3cf] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d0] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d1] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d2] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d3] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d4] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d5] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d6] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d7] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d8] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3d9] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3da] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3db] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3dc] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3dd] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3de] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3df] = { .c = { 0x38, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3e0] = { .c = { 0x39, 0x30 }, .l1 = 6, .l = 11 },
+	[0x3e1] = { .c = { 0x39, 0x31 }, .l1 = 6, .l = 11 },
+	[0x3e2] = { .c = { 0x39, 0x32 }, .l1 = 6, .l = 11 },
+	[0x3e3] = { .c = { 0x39, 0x61 }, .l1 = 6, .l = 11 },
+	[0x3e4] = { .c = { 0x39, 0x63 }, .l1 = 6, .l = 11 },
+	[0x3e5] = { .c = { 0x39, 0x65 }, .l1 = 6, .l = 11 },
+	[0x3e6] = { .c = { 0x39, 0x69 }, .l1 = 6, .l = 11 },
+	[0x3e7] = { .c = { 0x39, 0x6f }, .l1 = 6, .l = 11 },
+	[0x3e8] = { .c = { 0x39, 0x73 }, .l1 = 6, .l = 11 },
+	[0x3e9] = { .c = { 0x39, 0x74 }, .l1 = 6, .l = 11 },
+	[0x3ea] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3eb] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ec] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ed] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ee] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ef] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f0] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f1] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f2] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f3] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f4] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f5] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f6] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f7] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f8] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3f9] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3fa] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3fb] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3fc] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3fd] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3fe] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x3ff] = { .c = { 0x39, 0x00 }, .l1 = 6, .l = 6 },
+	[0x400] = { .c = { 0x3d, 0x30 }, .l1 = 6, .l = 11 },
+	[0x401] = { .c = { 0x3d, 0x31 }, .l1 = 6, .l = 11 },
+	[0x402] = { .c = { 0x3d, 0x32 }, .l1 = 6, .l = 11 },
+	[0x403] = { .c = { 0x3d, 0x61 }, .l1 = 6, .l = 11 },
+	[0x404] = { .c = { 0x3d, 0x63 }, .l1 = 6, .l = 11 },
+	[0x405] = { .c = { 0x3d, 0x65 }, .l1 = 6, .l = 11 },
+	[0x406] = { .c = { 0x3d, 0x69 }, .l1 = 6, .l = 11 },
+	[0x407] = { .c = { 0x3d, 0x6f }, .l1 = 6, .l = 11 },
+	[0x408] = { .c = { 0x3d, 0x73 }, .l1 = 6, .l = 11 },
+	[0x409] = { .c = { 0x3d, 0x74 }, .l1 = 6, .l = 11 },
+	[0x40a] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x40b] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x40c] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x40d] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x40e] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x40f] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x410] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x411] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x412] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x413] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x414] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x415] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x416] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x417] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x418] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x419] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x41a] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x41b] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x41c] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x41d] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x41e] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x41f] = { .c = { 0x3d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x420] = { .c = { 0x41, 0x30 }, .l1 = 6, .l = 11 },
+	[0x421] = { .c = { 0x41, 0x31 }, .l1 = 6, .l = 11 },
+	[0x422] = { .c = { 0x41, 0x32 }, .l1 = 6, .l = 11 },
+	[0x423] = { .c = { 0x41, 0x61 }, .l1 = 6, .l = 11 },
+	[0x424] = { .c = { 0x41, 0x63 }, .l1 = 6, .l = 11 },
+	[0x425] = { .c = { 0x41, 0x65 }, .l1 = 6, .l = 11 },
+	[0x426] = { .c = { 0x41, 0x69 }, .l1 = 6, .l = 11 },
+	[0x427] = { .c = { 0x41, 0x6f }, .l1 = 6, .l = 11 },
+	[0x428] = { .c = { 0x41, 0x73 }, .l1 = 6, .l = 11 },
+	[0x429] = { .c = { 0x41, 0x74 }, .l1 = 6, .l = 11 },
+	[0x42a] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x42b] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x42c] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x42d] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x42e] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x42f] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x430] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x431] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x432] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x433] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x434] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x435] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x436] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x437] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x438] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x439] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x43a] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x43b] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x43c] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x43d] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x43e] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x43f] = { .c = { 0x41, 0x00 }, .l1 = 6, .l = 6 },
+	[0x440] = { .c = { 0x5f, 0x30 }, .l1 = 6, .l = 11 },
+	[0x441] = { .c = { 0x5f, 0x31 }, .l1 = 6, .l = 11 },
+	[0x442] = { .c = { 0x5f, 0x32 }, .l1 = 6, .l = 11 },
+	[0x443] = { .c = { 0x5f, 0x61 }, .l1 = 6, .l = 11 },
+	[0x444] = { .c = { 0x5f, 0x63 }, .l1 = 6, .l = 11 },
+	[0x445] = { .c = { 0x5f, 0x65 }, .l1 = 6, .l = 11 },
+	[0x446] = { .c = { 0x5f, 0x69 }, .l1 = 6, .l = 11 },
+	[0x447] = { .c = { 0x5f, 0x6f }, .l1 = 6, .l = 11 },
+	[0x448] = { .c = { 0x5f, 0x73 }, .l1 = 6, .l = 11 },
+	[0x449] = { .c = { 0x5f, 0x74 }, .l1 = 6, .l = 11 },
+	[0x44a] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x44b] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x44c] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x44d] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x44e] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x44f] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x450] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x451] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x452] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x453] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x454] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x455] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x456] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x457] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x458] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x459] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x45a] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x45b] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x45c] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x45d] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x45e] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x45f] = { .c = { 0x5f, 0x00 }, .l1 = 6, .l = 6 },
+	[0x460] = { .c = { 0x62, 0x30 }, .l1 = 6, .l = 11 },
+	[0x461] = { .c = { 0x62, 0x31 }, .l1 = 6, .l = 11 },
+	[0x462] = { .c = { 0x62, 0x32 }, .l1 = 6, .l = 11 },
+	[0x463] = { .c = { 0x62, 0x61 }, .l1 = 6, .l = 11 },
+	[0x464] = { .c = { 0x62, 0x63 }, .l1 = 6, .l = 11 },
+	[0x465] = { .c = { 0x62, 0x65 }, .l1 = 6, .l = 11 },
+	[0x466] = { .c = { 0x62, 0x69 }, .l1 = 6, .l = 11 },
+	[0x467] = { .c = { 0x62, 0x6f }, .l1 = 6, .l = 11 },
+	[0x468] = { .c = { 0x62, 0x73 }, .l1 = 6, .l = 11 },
+	[0x469] = { .c = { 0x62, 0x74 }, .l1 = 6, .l = 11 },
+	[0x46a] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x46b] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x46c] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x46d] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x46e] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x46f] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x470] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x471] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x472] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x473] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x474] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x475] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x476] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x477] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x478] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x479] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x47a] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x47b] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x47c] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x47d] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x47e] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x47f] = { .c = { 0x62, 0x00 }, .l1 = 6, .l = 6 },
+	[0x480] = { .c = { 0x64, 0x30 }, .l1 = 6, .l = 11 },
+	[0x481] = { .c = { 0x64, 0x31 }, .l1 = 6, .l = 11 },
+	[0x482] = { .c = { 0x64, 0x32 }, .l1 = 6, .l = 11 },
+	[0x483] = { .c = { 0x64, 0x61 }, .l1 = 6, .l = 11 },
+	[0x484] = { .c = { 0x64, 0x63 }, .l1 = 6, .l = 11 },
+	[0x485] = { .c = { 0x64, 0x65 }, .l1 = 6, .l = 11 },
+	[0x486] = { .c = { 0x64, 0x69 }, .l1 = 6, .l = 11 },
+	[0x487] = { .c = { 0x64, 0x6f }, .l1 = 6, .l = 11 },
+	[0x488] = { .c = { 0x64, 0x73 }, .l1 = 6, .l = 11 },
+	[0x489] = { .c = { 0x64, 0x74 }, .l1 = 6, .l = 11 },
+	[0x48a] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x48b] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x48c] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x48d] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x48e] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x48f] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x490] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x491] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x492] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x493] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x494] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x495] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x496] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x497] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x498] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x499] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x49a] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x49b] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x49c] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x49d] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x49e] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x49f] = { .c = { 0x64, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4a0] = { .c = { 0x66, 0x30 }, .l1 = 6, .l = 11 },
+	[0x4a1] = { .c = { 0x66, 0x31 }, .l1 = 6, .l = 11 },
+	[0x4a2] = { .c = { 0x66, 0x32 }, .l1 = 6, .l = 11 },
+	[0x4a3] = { .c = { 0x66, 0x61 }, .l1 = 6, .l = 11 },
+	[0x4a4] = { .c = { 0x66, 0x63 }, .l1 = 6, .l = 11 },
+	[0x4a5] = { .c = { 0x66, 0x65 }, .l1 = 6, .l = 11 },
+	[0x4a6] = { .c = { 0x66, 0x69 }, .l1 = 6, .l = 11 },
+	[0x4a7] = { .c = { 0x66, 0x6f }, .l1 = 6, .l = 11 },
+	[0x4a8] = { .c = { 0x66, 0x73 }, .l1 = 6, .l = 11 },
+	[0x4a9] = { .c = { 0x66, 0x74 }, .l1 = 6, .l = 11 },
+	[0x4aa] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ab] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ac] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ad] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ae] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4af] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b0] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b1] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b2] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b3] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b4] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b5] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b6] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b7] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b8] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4b9] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ba] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4bb] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4bc] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4bd] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4be] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4bf] = { .c = { 0x66, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4c0] = { .c = { 0x67, 0x30 }, .l1 = 6, .l = 11 },
+	[0x4c1] = { .c = { 0x67, 0x31 }, .l1 = 6, .l = 11 },
+	[0x4c2] = { .c = { 0x67, 0x32 }, .l1 = 6, .l = 11 },
+	[0x4c3] = { .c = { 0x67, 0x61 }, .l1 = 6, .l = 11 },
+	[0x4c4] = { .c = { 0x67, 0x63 }, .l1 = 6, .l = 11 },
+	[0x4c5] = { .c = { 0x67, 0x65 }, .l1 = 6, .l = 11 },
+	[0x4c6] = { .c = { 0x67, 0x69 }, .l1 = 6, .l = 11 },
+	[0x4c7] = { .c = { 0x67, 0x6f }, .l1 = 6, .l = 11 },
+	[0x4c8] = { .c = { 0x67, 0x73 }, .l1 = 6, .l = 11 },
+	[0x4c9] = { .c = { 0x67, 0x74 }, .l1 = 6, .l = 11 },
+	[0x4ca] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4cb] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4cc] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4cd] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ce] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4cf] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d0] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d1] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d2] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d3] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d4] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d5] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d6] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d7] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d8] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4d9] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4da] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4db] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4dc] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4dd] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4de] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4df] = { .c = { 0x67, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4e0] = { .c = { 0x68, 0x30 }, .l1 = 6, .l = 11 },
+	[0x4e1] = { .c = { 0x68, 0x31 }, .l1 = 6, .l = 11 },
+	[0x4e2] = { .c = { 0x68, 0x32 }, .l1 = 6, .l = 11 },
+	[0x4e3] = { .c = { 0x68, 0x61 }, .l1 = 6, .l = 11 },
+	[0x4e4] = { .c = { 0x68, 0x63 }, .l1 = 6, .l = 11 },
+	[0x4e5] = { .c = { 0x68, 0x65 }, .l1 = 6, .l = 11 },
+	[0x4e6] = { .c = { 0x68, 0x69 }, .l1 = 6, .l = 11 },
+	[0x4e7] = { .c = { 0x68, 0x6f }, .l1 = 6, .l = 11 },
+	[0x4e8] = { .c = { 0x68, 0x73 }, .l1 = 6, .l = 11 },
+	[0x4e9] = { .c = { 0x68, 0x74 }, .l1 = 6, .l = 11 },
+	[0x4ea] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4eb] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ec] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ed] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ee] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ef] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f0] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f1] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f2] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f3] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f4] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f5] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f6] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f7] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f8] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4f9] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4fa] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4fb] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4fc] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4fd] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4fe] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x4ff] = { .c = { 0x68, 0x00 }, .l1 = 6, .l = 6 },
+	[0x500] = { .c = { 0x6c, 0x30 }, .l1 = 6, .l = 11 },
+	[0x501] = { .c = { 0x6c, 0x31 }, .l1 = 6, .l = 11 },
+	[0x502] = { .c = { 0x6c, 0x32 }, .l1 = 6, .l = 11 },
+	[0x503] = { .c = { 0x6c, 0x61 }, .l1 = 6, .l = 11 },
+	[0x504] = { .c = { 0x6c, 0x63 }, .l1 = 6, .l = 11 },
+	[0x505] = { .c = { 0x6c, 0x65 }, .l1 = 6, .l = 11 },
+	[0x506] = { .c = { 0x6c, 0x69 }, .l1 = 6, .l = 11 },
+	[0x507] = { .c = { 0x6c, 0x6f }, .l1 = 6, .l = 11 },
+	[0x508] = { .c = { 0x6c, 0x73 }, .l1 = 6, .l = 11 },
+	[0x509] = { .c = { 0x6c, 0x74 }, .l1 = 6, .l = 11 },
+	[0x50a] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x50b] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x50c] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x50d] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x50e] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x50f] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x510] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x511] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x512] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x513] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x514] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x515] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x516] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x517] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x518] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x519] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x51a] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x51b] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x51c] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x51d] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x51e] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x51f] = { .c = { 0x6c, 0x00 }, .l1 = 6, .l = 6 },
+	[0x520] = { .c = { 0x6d, 0x30 }, .l1 = 6, .l = 11 },
+	[0x521] = { .c = { 0x6d, 0x31 }, .l1 = 6, .l = 11 },
+	[0x522] = { .c = { 0x6d, 0x32 }, .l1 = 6, .l = 11 },
+	[0x523] = { .c = { 0x6d, 0x61 }, .l1 = 6, .l = 11 },
+	[0x524] = { .c = { 0x6d, 0x63 }, .l1 = 6, .l = 11 },
+	[0x525] = { .c = { 0x6d, 0x65 }, .l1 = 6, .l = 11 },
+	[0x526] = { .c = { 0x6d, 0x69 }, .l1 = 6, .l = 11 },
+	[0x527] = { .c = { 0x6d, 0x6f }, .l1 = 6, .l = 11 },
+	[0x528] = { .c = { 0x6d, 0x73 }, .l1 = 6, .l = 11 },
+	[0x529] = { .c = { 0x6d, 0x74 }, .l1 = 6, .l = 11 },
+	[0x52a] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x52b] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x52c] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x52d] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x52e] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x52f] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x530] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x531] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x532] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x533] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x534] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x535] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x536] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x537] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x538] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x539] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x53a] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x53b] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x53c] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x53d] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x53e] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x53f] = { .c = { 0x6d, 0x00 }, .l1 = 6, .l = 6 },
+	[0x540] = { .c = { 0x6e, 0x30 }, .l1 = 6, .l = 11 },
+	[0x541] = { .c = { 0x6e, 0x31 }, .l1 = 6, .l = 11 },
+	[0x542] = { .c = { 0x6e, 0x32 }, .l1 = 6, .l = 11 },
+	[0x543] = { .c = { 0x6e, 0x61 }, .l1 = 6, .l = 11 },
+	[0x544] = { .c = { 0x6e, 0x63 }, .l1 = 6, .l = 11 },
+	[0x545] = { .c = { 0x6e, 0x65 }, .l1 = 6, .l = 11 },
+	[0x546] = { .c = { 0x6e, 0x69 }, .l1 = 6, .l = 11 },
+	[0x547] = { .c = { 0x6e, 0x6f }, .l1 = 6, .l = 11 },
+	[0x548] = { .c = { 0x6e, 0x73 }, .l1 = 6, .l = 11 },
+	[0x549] = { .c = { 0x6e, 0x74 }, .l1 = 6, .l = 11 },
+	[0x54a] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x54b] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x54c] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x54d] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x54e] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x54f] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x550] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x551] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x552] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x553] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x554] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x555] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x556] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x557] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x558] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x559] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x55a] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x55b] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x55c] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x55d] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x55e] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x55f] = { .c = { 0x6e, 0x00 }, .l1 = 6, .l = 6 },
+	[0x560] = { .c = { 0x70, 0x30 }, .l1 = 6, .l = 11 },
+	[0x561] = { .c = { 0x70, 0x31 }, .l1 = 6, .l = 11 },
+	[0x562] = { .c = { 0x70, 0x32 }, .l1 = 6, .l = 11 },
+	[0x563] = { .c = { 0x70, 0x61 }, .l1 = 6, .l = 11 },
+	[0x564] = { .c = { 0x70, 0x63 }, .l1 = 6, .l = 11 },
+	[0x565] = { .c = { 0x70, 0x65 }, .l1 = 6, .l = 11 },
+	[0x566] = { .c = { 0x70, 0x69 }, .l1 = 6, .l = 11 },
+	[0x567] = { .c = { 0x70, 0x6f }, .l1 = 6, .l = 11 },
+	[0x568] = { .c = { 0x70, 0x73 }, .l1 = 6, .l = 11 },
+	[0x569] = { .c = { 0x70, 0x74 }, .l1 = 6, .l = 11 },
+	[0x56a] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x56b] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x56c] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x56d] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x56e] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x56f] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x570] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x571] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x572] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x573] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x574] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x575] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x576] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x577] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x578] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x579] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x57a] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x57b] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x57c] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x57d] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x57e] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x57f] = { .c = { 0x70, 0x00 }, .l1 = 6, .l = 6 },
+	[0x580] = { .c = { 0x72, 0x30 }, .l1 = 6, .l = 11 },
+	[0x581] = { .c = { 0x72, 0x31 }, .l1 = 6, .l = 11 },
+	[0x582] = { .c = { 0x72, 0x32 }, .l1 = 6, .l = 11 },
+	[0x583] = { .c = { 0x72, 0x61 }, .l1 = 6, .l = 11 },
+	[0x584] = { .c = { 0x72, 0x63 }, .l1 = 6, .l = 11 },
+	[0x585] = { .c = { 0x72, 0x65 }, .l1 = 6, .l = 11 },
+	[0x586] = { .c = { 0x72, 0x69 }, .l1 = 6, .l = 11 },
+	[0x587] = { .c = { 0x72, 0x6f }, .l1 = 6, .l = 11 },
+	[0x588] = { .c = { 0x72, 0x73 }, .l1 = 6, .l = 11 },
+	[0x589] = { .c = { 0x72, 0x74 }, .l1 = 6, .l = 11 },
+	[0x58a] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x58b] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x58c] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x58d] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x58e] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x58f] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x590] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x591] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x592] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x593] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x594] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x595] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x596] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x597] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x598] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x599] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x59a] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x59b] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x59c] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x59d] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x59e] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x59f] = { .c = { 0x72, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5a0] = { .c = { 0x75, 0x30 }, .l1 = 6, .l = 11 },
+	[0x5a1] = { .c = { 0x75, 0x31 }, .l1 = 6, .l = 11 },
+	[0x5a2] = { .c = { 0x75, 0x32 }, .l1 = 6, .l = 11 },
+	[0x5a3] = { .c = { 0x75, 0x61 }, .l1 = 6, .l = 11 },
+	[0x5a4] = { .c = { 0x75, 0x63 }, .l1 = 6, .l = 11 },
+	[0x5a5] = { .c = { 0x75, 0x65 }, .l1 = 6, .l = 11 },
+	[0x5a6] = { .c = { 0x75, 0x69 }, .l1 = 6, .l = 11 },
+	[0x5a7] = { .c = { 0x75, 0x6f }, .l1 = 6, .l = 11 },
+	[0x5a8] = { .c = { 0x75, 0x73 }, .l1 = 6, .l = 11 },
+	[0x5a9] = { .c = { 0x75, 0x74 }, .l1 = 6, .l = 11 },
+	[0x5aa] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5ab] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5ac] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5ad] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5ae] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5af] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b0] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b1] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b2] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b3] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b4] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b5] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b6] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b7] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b8] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5b9] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5ba] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5bb] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5bc] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5bd] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5be] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5bf] = { .c = { 0x75, 0x00 }, .l1 = 6, .l = 6 },
+	[0x5c0] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c1] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c2] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c3] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c4] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c5] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c6] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c7] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c8] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5c9] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ca] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5cb] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5cc] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5cd] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ce] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5cf] = { .c = { 0x3a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d0] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d1] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d2] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d3] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d4] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d5] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d6] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d7] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d8] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5d9] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5da] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5db] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5dc] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5dd] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5de] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5df] = { .c = { 0x42, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e0] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e1] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e2] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e3] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e4] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e5] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e6] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e7] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e8] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5e9] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ea] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5eb] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ec] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ed] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ee] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ef] = { .c = { 0x43, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f0] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f1] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f2] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f3] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f4] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f5] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f6] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f7] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f8] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5f9] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5fa] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5fb] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5fc] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5fd] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5fe] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x5ff] = { .c = { 0x44, 0x00 }, .l1 = 7, .l = 7 },
+	[0x600] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x601] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x602] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x603] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x604] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x605] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x606] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x607] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x608] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x609] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x60a] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x60b] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x60c] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x60d] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x60e] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x60f] = { .c = { 0x45, 0x00 }, .l1 = 7, .l = 7 },
+	[0x610] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x611] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x612] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x613] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x614] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x615] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x616] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x617] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x618] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x619] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x61a] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x61b] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x61c] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x61d] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x61e] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x61f] = { .c = { 0x46, 0x00 }, .l1 = 7, .l = 7 },
+	[0x620] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x621] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x622] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x623] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x624] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x625] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x626] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x627] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x628] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x629] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x62a] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x62b] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x62c] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x62d] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x62e] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x62f] = { .c = { 0x47, 0x00 }, .l1 = 7, .l = 7 },
+	[0x630] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x631] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x632] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x633] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x634] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x635] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x636] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x637] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x638] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x639] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x63a] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x63b] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x63c] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x63d] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x63e] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x63f] = { .c = { 0x48, 0x00 }, .l1 = 7, .l = 7 },
+	[0x640] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x641] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x642] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x643] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x644] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x645] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x646] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x647] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x648] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x649] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x64a] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x64b] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x64c] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x64d] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x64e] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x64f] = { .c = { 0x49, 0x00 }, .l1 = 7, .l = 7 },
+	[0x650] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x651] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x652] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x653] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x654] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x655] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x656] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x657] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x658] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x659] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x65a] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x65b] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x65c] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x65d] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x65e] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x65f] = { .c = { 0x4a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x660] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x661] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x662] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x663] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x664] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x665] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x666] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x667] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x668] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x669] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x66a] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x66b] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x66c] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x66d] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x66e] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x66f] = { .c = { 0x4b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x670] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x671] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x672] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x673] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x674] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x675] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x676] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x677] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x678] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x679] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x67a] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x67b] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x67c] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x67d] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x67e] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x67f] = { .c = { 0x4c, 0x00 }, .l1 = 7, .l = 7 },
+	[0x680] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x681] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x682] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x683] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x684] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x685] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x686] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x687] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x688] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x689] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x68a] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x68b] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x68c] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x68d] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x68e] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x68f] = { .c = { 0x4d, 0x00 }, .l1 = 7, .l = 7 },
+	[0x690] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x691] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x692] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x693] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x694] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x695] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x696] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x697] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x698] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x699] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x69a] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x69b] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x69c] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x69d] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x69e] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x69f] = { .c = { 0x4e, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a0] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a1] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a2] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a3] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a4] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a5] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a6] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a7] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a8] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6a9] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6aa] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ab] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ac] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ad] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ae] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6af] = { .c = { 0x4f, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b0] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b1] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b2] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b3] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b4] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b5] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b6] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b7] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b8] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6b9] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ba] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6bb] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6bc] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6bd] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6be] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6bf] = { .c = { 0x50, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c0] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c1] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c2] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c3] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c4] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c5] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c6] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c7] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c8] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6c9] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ca] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6cb] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6cc] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6cd] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ce] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6cf] = { .c = { 0x51, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d0] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d1] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d2] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d3] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d4] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d5] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d6] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d7] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d8] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6d9] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6da] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6db] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6dc] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6dd] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6de] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6df] = { .c = { 0x52, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e0] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e1] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e2] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e3] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e4] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e5] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e6] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e7] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e8] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6e9] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ea] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6eb] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ec] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ed] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ee] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ef] = { .c = { 0x53, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f0] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f1] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f2] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f3] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f4] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f5] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f6] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f7] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f8] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6f9] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6fa] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6fb] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6fc] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6fd] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6fe] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x6ff] = { .c = { 0x54, 0x00 }, .l1 = 7, .l = 7 },
+	[0x700] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x701] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x702] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x703] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x704] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x705] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x706] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x707] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x708] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x709] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x70a] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x70b] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x70c] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x70d] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x70e] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x70f] = { .c = { 0x55, 0x00 }, .l1 = 7, .l = 7 },
+	[0x710] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x711] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x712] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x713] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x714] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x715] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x716] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x717] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x718] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x719] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x71a] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x71b] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x71c] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x71d] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x71e] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x71f] = { .c = { 0x56, 0x00 }, .l1 = 7, .l = 7 },
+	[0x720] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x721] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x722] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x723] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x724] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x725] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x726] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x727] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x728] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x729] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x72a] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x72b] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x72c] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x72d] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x72e] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x72f] = { .c = { 0x57, 0x00 }, .l1 = 7, .l = 7 },
+	[0x730] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x731] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x732] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x733] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x734] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x735] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x736] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x737] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x738] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x739] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x73a] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x73b] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x73c] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x73d] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x73e] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x73f] = { .c = { 0x59, 0x00 }, .l1 = 7, .l = 7 },
+	[0x740] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x741] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x742] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x743] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x744] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x745] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x746] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x747] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x748] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x749] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x74a] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x74b] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x74c] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x74d] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x74e] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x74f] = { .c = { 0x6a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x750] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x751] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x752] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x753] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x754] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x755] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x756] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x757] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x758] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x759] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x75a] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x75b] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x75c] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x75d] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x75e] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x75f] = { .c = { 0x6b, 0x00 }, .l1 = 7, .l = 7 },
+	[0x760] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x761] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x762] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x763] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x764] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x765] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x766] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x767] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x768] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x769] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x76a] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x76b] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x76c] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x76d] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x76e] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x76f] = { .c = { 0x71, 0x00 }, .l1 = 7, .l = 7 },
+	[0x770] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x771] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x772] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x773] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x774] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x775] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x776] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x777] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x778] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x779] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x77a] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x77b] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x77c] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x77d] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x77e] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x77f] = { .c = { 0x76, 0x00 }, .l1 = 7, .l = 7 },
+	[0x780] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x781] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x782] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x783] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x784] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x785] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x786] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x787] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x788] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x789] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x78a] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x78b] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x78c] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x78d] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x78e] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x78f] = { .c = { 0x77, 0x00 }, .l1 = 7, .l = 7 },
+	[0x790] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x791] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x792] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x793] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x794] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x795] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x796] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x797] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x798] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x799] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x79a] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x79b] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x79c] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x79d] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x79e] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x79f] = { .c = { 0x78, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a0] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a1] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a2] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a3] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a4] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a5] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a6] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a7] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a8] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7a9] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7aa] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7ab] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7ac] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7ad] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7ae] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7af] = { .c = { 0x79, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b0] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b1] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b2] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b3] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b4] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b5] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b6] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b7] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b8] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7b9] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7ba] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7bb] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7bc] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7bd] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7be] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7bf] = { .c = { 0x7a, 0x00 }, .l1 = 7, .l = 7 },
+	[0x7c0] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c1] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c2] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c3] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c4] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c5] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c6] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c7] = { .c = { 0x26, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c8] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7c9] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7ca] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7cb] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7cc] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7cd] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7ce] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7cf] = { .c = { 0x2a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d0] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d1] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d2] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d3] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d4] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d5] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d6] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d7] = { .c = { 0x2c, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d8] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7d9] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7da] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7db] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7dc] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7dd] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7de] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7df] = { .c = { 0x3b, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e0] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e1] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e2] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e3] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e4] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e5] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e6] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e7] = { .c = { 0x58, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e8] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7e9] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7ea] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7eb] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7ec] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7ed] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7ee] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7ef] = { .c = { 0x5a, 0x00 }, .l1 = 8, .l = 8 },
+	[0x7f0] = { .c = { 0x21, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f1] = { .c = { 0x21, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f2] = { .c = { 0x22, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f3] = { .c = { 0x22, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f4] = { .c = { 0x28, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f5] = { .c = { 0x28, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f6] = { .c = { 0x29, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f7] = { .c = { 0x29, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f8] = { .c = { 0x3f, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7f9] = { .c = { 0x3f, 0x00 }, .l1 = 10, .l = 10 },
+	[0x7fa] = { .c = { 0x27, 0x00 }, .l1 = 11, .l = 11 },
+	[0x7fb] = { .c = { 0x2b, 0x00 }, .l1 = 11, .l = 11 },
+	[0x7fc] = { .c = { 0x7c, 0x00 }, .l1 = 11, .l = 11 },
+};
@@ -0,0 +1,93 @@
+/* Perfect hash of the static table's names, generated by "gen-rht -s".
+ * Do not edit. Each slot gives the name, its length, the first static table
+ * index having this name and the number of consecutive indexes sharing it.
+ */
+#define SH_HASH_BITS 7
+#define SH_HASH_SEED 0x2e9e0e97
+
+static const struct sh_hash {
+	const char *n;
+	uint8_t len;
+	uint8_t idx;
+	uint8_t cnt;
+} sh_hash[1 << SH_HASH_BITS] = {
+	[  4] = { ":path",                        5,  4, 2 },
+	[  6] = { "from",                         4, 37, 1 },
+	[  7] = { "range",                        5, 50, 1 },
+	[  8] = { "content-location",            16, 29, 1 },
+	[ 13] = { "server",                       6, 54, 1 },
+	[ 14] = { "vary",                         4, 59, 1 },
+	[ 17] = { "accept-language",             15, 17, 1 },
+	[ 19] = { ":status",                      7,  8, 7 },
+	[ 21] = { "location",                     8, 46, 1 },
+	[ 24] = { "if-modified-since",           17, 40, 1 },
+	[ 25] = { "content-type",                12, 31, 1 },
+	[ 28] = { "if-match",                     8, 39, 1 },
+	[ 30] = { "content-disposition",         19, 25, 1 },
+	[ 32] = { "content-range",               13, 30, 1 },
+	[ 33] = { "proxy-authorization",         19, 49, 1 },
+	[ 38] = { "if-unmodified-since",         19, 43, 1 },
+	[ 43] = { "etag",                         4, 34, 1 },
+	[ 44] = { "transfer-encoding",           17, 57, 1 },
+	[ 45] = { "accept",                       6, 19, 1 },
+	[ 46] = { "date",                         4, 33, 1 },
+	[ 50] = { "link",                         4, 45, 1 },
+	[ 52] = { ":authority",                  10,  1, 1 },
+	[ 53] = { ":method",                      7,  2, 2 },
+	[ 54] = { "content-language",            16, 27, 1 },
+	[ 57] = { "age",                          3, 21, 1 },
+	[ 58] = { "access-control-allow-origin", 27, 20, 1 },
+	[ 59] = { "strict-transport-security",   25, 56, 1 },
+	[ 63] = { "accept-encoding",             15, 16, 1 },
+	[ 64] = { "if-none-match",               13, 41, 1 },
+	[ 67] = { "cache-control",               13, 24, 1 },
+	[ 69] = { "referer",                      7, 51, 1 },
+	[ 71] = { "host",                         4, 38, 1 },
+	[ 72] = { "proxy-authenticate",          18, 48, 1 },
+	[ 73] = { "accept-ranges",               13, 18, 1 },
+	[ 76] = { ":scheme",                      7,  6, 2 },
+	[ 80] = { "last-modified",               13, 44, 1 },
+	[ 84] = { "authorization",               13, 23, 1 },
+	[ 86] = { "if-range",                     8, 42, 1 },
+	[ 88] = { "via",                          3, 60, 1 },
+	[ 89] = { "expires",                      7, 36, 1 },
+	[ 92] = { "refresh",                      7, 52, 1 },
+	[ 98] = { "retry-after",                 11, 53, 1 },
+	[ 99] = { "www-authenticate",            16, 61, 1 },
+	[101] = { "content-encoding",            16, 26, 1 },
+	[103] = { "accept-charset",              14, 15, 1 },
+	[105] = { "expect",                       6, 35, 1 },
+	[107] = { "allow",                        5, 22, 1 },
+	[109] = { "cookie",                       6, 32, 1 },
+	[110] = { "content-length",              14, 28, 1 },
+	[118] = { "max-forwards",                12, 47, 1 },
+	[119] = { "user-agent",                  10, 58, 1 },
+	[123] = { "set-cookie",                  10, 55, 1 },
+};
+
+/* returns the hash slot of name <n> of length <len>, which must not be 0 */
+static inline uint32_t sh_hash_slot(const char *n, size_t len)
+{
+	uint32_t key = (len << 16) | ((n[0] | 0x20) << 8) | (n[len - 1] | 0x20);
+
+	return (key * SH_HASH_SEED) >> (32 - SH_HASH_BITS);
+}
+
+/* looks up name <n> of length <len> in the static table. Returns the first
+ * index having this name and sets <cnt> to the number of indexes sharing it,
+ * or returns 0 if the name is not there.
+ */
+static inline int sh_lookup_name(const char *n, size_t len, int *cnt)
+{
+	const struct sh_hash *e;
+
+	if (!len)
+		return 0;
+
+	e = &sh_hash[sh_hash_slot(n, len)];
+	if (e->len != len || strncasecmp(n, e->n, len) != 0)
+		return 0;
+
+	*cnt = e->cnt;
+	return e->idx;
+}
@@ -0,0 +1,722 @@
+/* HPACK dynamic headers table, shared by the encoder and the decoder. See
+ * hpack-tbl.h for a description of the layout.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hpack-tbl.h"
+
+/* incremental defragmentation : a compaction starts when a wrapped index has
+ * less than DHT_INC_SLOTS free slots, and it copies DHT_INC_STEP entries at
+ * most per insertion.
+ */
+#define DHT_INC_SLOTS   32
+#define DHT_INC_STEP    16
+
+/* static header table, shared by the encoder and the decoder. [0] unused. */
+const struct hpack_hdr hpack_sh[HPACK_SH_SIZE + 1] = {
+	[ 1] = { .n = { ":authority",                  10 }, .v = { "",               0 } },
+	[ 2] = { .n = { ":method",                      7 }, .v = { "GET",            3 } },
+	[ 3] = { .n = { ":method",                      7 }, .v = { "POST",           4 } },
+	[ 4] = { .n = { ":path",                        5 }, .v = { "/",              1 } },
+	[ 5] = { .n = { ":path",                        5 }, .v = { "/index.html",   11 } },
+	[ 6] = { .n = { ":scheme",                      7 }, .v = { "http",           4 } },
+	[ 7] = { .n = { ":scheme",                      7 }, .v = { "https",          5 } },
+	[ 8] = { .n = { ":status",                      7 }, .v = { "200",            3 } },
+	[ 9] = { .n = { ":status",                      7 }, .v = { "204",            3 } },
+	[10] = { .n = { ":status",                      7 }, .v = { "206",            3 } },
+	[11] = { .n = { ":status",                      7 }, .v = { "304",            3 } },
+	[12] = { .n = { ":status",                      7 }, .v = { "400",            3 } },
+	[13] = { .n = { ":status",                      7 }, .v = { "404",            3 } },
+	[14] = { .n = { ":status",                      7 }, .v = { "500",            3 } },
+	[15] = { .n = { "accept-charset",              14 }, .v = { "",               0 } },
+	[16] = { .n = { "accept-encoding",             15 }, .v = { "gzip, deflate", 13 } },
+	[17] = { .n = { "accept-language",             15 }, .v = { "",               0 } },
+	[18] = { .n = { "accept-ranges",               13 }, .v = { "",               0 } },
+	[19] = { .n = { "accept",                       6 }, .v = { "",               0 } },
+	[20] = { .n = { "access-control-allow-origin", 27 }, .v = { "",               0 } },
+	[21] = { .n = { "age",                          3 }, .v = { "",               0 } },
+	[22] = { .n = { "allow",                        5 }, .v = { "",               0 } },
+	[23] = { .n = { "authorization",               13 }, .v = { "",               0 } },
+	[24] = { .n = { "cache-control",               13 }, .v = { "",               0 } },
+	[25] = { .n = { "content-disposition",         19 }, .v = { "",               0 } },
+	[26] = { .n = { "content-encoding",            16 }, .v = { "",               0 } },
+	[27] = { .n = { "content-language",            16 }, .v = { "",               0 } },
+	[28] = { .n = { "content-length",              14 }, .v = { "",               0 } },
+	[29] = { .n = { "content-location",            16 }, .v = { "",               0 } },
+	[30] = { .n = { "content-range",               13 }, .v = { "",               0 } },
+	[31] = { .n = { "content-type",                12 }, .v = { "",               0 } },
+	[32] = { .n = { "cookie",                       6 }, .v = { "",               0 } },
+	[33] = { .n = { "date",                         4 }, .v = { "",               0 } },
+	[34] = { .n = { "etag",                         4 }, .v = { "",               0 } },
+	[35] = { .n = { "expect",                       6 }, .v = { "",               0 } },
+	[36] = { .n = { "expires",                      7 }, .v = { "",               0 } },
+	[37] = { .n = { "from",                         4 }, .v = { "",               0 } },
+	[38] = { .n = { "host",                         4 }, .v = { "",               0 } },
+	[39] = { .n = { "if-match",                     8 }, .v = { "",               0 } },
+	[40] = { .n = { "if-modified-since",           17 }, .v = { "",               0 } },
+	[41] = { .n = { "if-none-match",               13 }, .v = { "",               0 } },
+	[42] = { .n = { "if-range",                     8 }, .v = { "",               0 } },
+	[43] = { .n = { "if-unmodified-since",         19 }, .v = { "",               0 } },
+	[44] = { .n = { "last-modified",               13 }, .v = { "",               0 } },
+	[45] = { .n = { "link",                         4 }, .v = { "",               0 } },
+	[46] = { .n = { "location",                     8 }, .v = { "",               0 } },
+	[47] = { .n = { "max-forwards",                12 }, .v = { "",               0 } },
+	[48] = { .n = { "proxy-authenticate",          18 }, .v = { "",               0 } },
+	[49] = { .n = { "proxy-authorization",         19 }, .v = { "",               0 } },
+	[50] = { .n = { "range",                        5 }, .v = { "",               0 } },
+	[51] = { .n = { "referer",                      7 }, .v = { "",               0 } },
+	[52] = { .n = { "refresh",                      7 }, .v = { "",               0 } },
+	[53] = { .n = { "retry-after",                 11 }, .v = { "",               0 } },
+	[54] = { .n = { "server",                       6 }, .v = { "",               0 } },
+	[55] = { .n = { "set-cookie",                  10 }, .v = { "",               0 } },
+	[56] = { .n = { "strict-transport-security",   25 }, .v = { "",               0 } },
+	[57] = { .n = { "transfer-encoding",           17 }, .v = { "",               0 } },
+	[58] = { .n = { "user-agent",                  10 }, .v = { "",               0 } },
+	[59] = { .n = { "vary",                         4 }, .v = { "",               0 } },
+	[60] = { .n = { "via",                          3 }, .v = { "",               0 } },
+	[61] = { .n = { "www-authenticate",            16 }, .v = { "",               0 } },
+};
+
+/* check for the whole dynamic header table consistency, abort on failures */
+void dht_check_consistency(const struct dht *dht)
+{
+	unsigned slot = dht_get_tail(dht);
+	unsigned used2 = dht->used;
+	unsigned total = 0;
+
+	if (!dht->used)
+		return;
+
+	if (dht->front >= dht->wrap)
+		abort();
+
+	if (dht->used > dht->wrap)
+		abort();
+
+	if (dht->head >= dht->wrap)
+		abort();
+
+	while (used2--) {
+		total += dht->dte[slot].nlen + dht->dte[slot].vlen;
+		slot++;
+		if (slot >= dht->wrap)
+			slot = 0;
+	}
+
+	if (total != dht->total) {
+		fprintf(stderr, "%d: total=%u dht=%u\n", __LINE__, total, dht->total);
+		abort();
+	}
+}
+
+/* rebuild a new dynamic header table of <size> bytes from <dht> into <*alt>,
+ * which must be at least <size> bytes large, with an unwrapped index and
+ * contents at the end. <size> is usually dht->size, and may only be smaller if
+ * the contents fit. The new table is returned, and <*alt> is set to the
+ * previous one so that it serves as the next defragmentation area. The caller
+ * must not use the previous table anymore.
+ */
+static struct dht *dht_defrag(struct dht *dht, struct dht **alt, uint32_t size)
+{
+	struct dht *alt_dht = *alt;
+	uint16_t old, new;
+	uint32_t addr;
+
+	//fprintf(stderr, "defrag\n");
+	alt_dht->size = size;
+	alt_dht->total = dht->total;
+	alt_dht->used = dht->used;
+	alt_dht->wrap = dht->used;
+
+	new = 0;
+	addr = alt_dht->size;
+
+	if (dht->used) {
+		/* start from the tail */
+		old = dht_get_tail(dht);
+		do {
+			alt_dht->dte[new].nlen = dht->dte[old].nlen;
+			alt_dht->dte[new].vlen = dht->dte[old].vlen;
+			addr -= dht->dte[old].nlen + dht->dte[old].vlen;
+			alt_dht->dte[new].addr = addr;
+
+			memcpy((void *)alt_dht + alt_dht->dte[new].addr,
+			       (void *)dht + dht->dte[old].addr,
+			       dht->dte[old].nlen + dht->dte[old].vlen);
+
+			old++;
+			if (old >= dht->wrap)
+				old = 0;
+			new++;
+		} while (new < dht->used);
+	}
+
+	alt_dht->front = alt_dht->head = new - 1;
+
+	*alt = dht;
+	return alt_dht;
+}
+
+/* Purges table dht until a header field of <needed> bytes fits according to
+ * the protocol (adding 32 bytes overhead). Returns non-zero on success, zero
+ * on failure (ie: table empty but still not sufficient). It must only be
+ * called when the table is not large enough to suit the new entry and there
+ * are some entries left. In case of doubt, use dht_make_room() instead.
+ */
+static int __dht_make_room(struct dht *dht, unsigned int needed)
+{
+	unsigned int used = dht->used;
+	unsigned int wrap = dht->wrap;
+	unsigned int tail;
+
+	do {
+		tail = ((dht->head + 1U < used) ? wrap : 0) + dht->head + 1U - used;
+		dht->total -= dht->dte[tail].nlen + dht->dte[tail].vlen;
+		if (tail == dht->front)
+			dht->front = dht->head;
+		used--;
+	} while (used && used * 32 + dht->total + needed + 32 > dht->size);
+
+	dht->used = used;
+
+	/* realign if empty */
+	if (!used)
+		dht->front = dht->head = 0;
+
+	/* pack the table if it doesn't wrap anymore */
+	if (dht->head + 1U >= used)
+		dht->wrap = dht->head + 1;
+
+	/* no need to check for 'used' here as if it doesn't fit, used==0 */
+	return needed + 32 <= dht->size;
+}
+
+/* Purges table dht until a header field of <needed> bytes fits according to
+ * the protocol (adding 32 bytes overhead). Returns non-zero on success, zero
+ * on failure (ie: table empty but still not sufficient).
+ */
+static inline int dht_make_room(struct dht *dht, unsigned int needed)
+{
+	if (!dht->used)
+		return needed + 32 <= dht->size;
+
+	if (dht->used * 32 + dht->total + needed + 32 <= dht->size)
+		return 1;
+
+	return __dht_make_room(dht, needed);
+}
+
+/* computes into <*head> and <*wrap> the slot and the index size the next entry
+ * of non-empty table <dht> would use if the lowest data in the table were at
+ * offset <low>. Returns zero if the index would have to be defragmented first.
+ * This follows the same rules as dht_insert().
+ */
+static int dht_next_slot(const struct dht *dht, uint32_t low, unsigned int *head, unsigned int *wrap)
+{
+	*head = dht->head + 1;
+	*wrap = dht->wrap;
+
+	if (*head >= *wrap) {
+		if (sizeof(*dht) + (*wrap + 1) * sizeof(dht->dte[0]) <= low)
+			(*wrap)++;
+		else if (*head >= dht->used + 1U)
+			*head = 0;
+		else
+			return 0;
+	}
+	else if (dht->used + 1U >= *wrap)
+		return 0;
+	return 1;
+}
+
+/* returns non-zero if the <len> bytes at offset <addr> of non-empty table <dht>
+ * are in the area its next entry may be stored in with an index of <wrap>
+ * slots : between the index and the front entry if the head is the front one,
+ * otherwise between the tail's end and the head, or the table's end if the
+ * head is the front one.
+ */
+static int dht_room_at(const struct dht *dht, uint32_t addr, uint32_t len, unsigned int wrap)
+{
+	unsigned int tail = dht_get_tail(dht);
+	uint32_t tail_end = dht->dte[tail].addr + dht->dte[tail].nlen + dht->dte[tail].vlen;
+
+	if (addr < sizeof(*dht) + wrap * sizeof(dht->dte[0]))
+		return 0;
+
+	if (dht->head == dht->front)
+		return addr + len <= dht->dte[dht->front].addr ||
+		       (addr >= tail_end && addr + len <= dht->size);
+
+	return addr >= tail_end && addr + len <= dht->dte[dht->head].addr;
+}
+
+/* Reserves <len> bytes in the free space of <dht> where its next entry may be
+ * stored without evicting nor moving anything, for callers which build the
+ * entry in place, such as a decoder which doesn't know the decoded length of
+ * a Huffman-encoded value in advance. The name followed by the value must be
+ * written there, then passed to dht_insert() which keeps them in place if the
+ * table still permits it. An entry shorter than reserved should be moved to
+ * the end of the area first, otherwise the unused bytes remain lost until the
+ * entries before them are evicted or the table is defragmented. Returns a
+ * pointer to the area, or NULL if there is no such room.
+ */
+char *dht_reserve(const struct dht *dht, uint32_t len)
+{
+	unsigned int head, wrap, tail;
+	uint32_t addr, end, tail_end;
+
+	if (!dht->used) {
+		if (sizeof(*dht) + sizeof(dht->dte[0]) + len > dht->size)
+			return NULL;
+		return (char *)dht + dht->size - len;
+	}
+
+	if (dht->head == dht->front && dht->dte[dht->front].addr >= len) {
+		/* below the front entry */
+		addr = dht->dte[dht->front].addr - len;
+		if (dht_next_slot(dht, addr, &head, &wrap) &&
+		    addr >= sizeof(*dht) + wrap * sizeof(dht->dte[0]))
+			return (char *)dht + addr;
+	}
+
+	/* after the tail */
+	tail = dht_get_tail(dht);
+	tail_end = dht->dte[tail].addr + dht->dte[tail].nlen + dht->dte[tail].vlen;
+	end = (dht->head == dht->front) ? dht->size : dht->dte[dht->head].addr;
+	if (end < tail_end + len)
+		return NULL;
+
+	addr = end - len;
+	if (dht_next_slot(dht, dht->dte[dht->front].addr, &head, &wrap) &&
+	    addr >= sizeof(*dht) + wrap * sizeof(dht->dte[0]))
+		return (char *)dht + addr;
+	return NULL;
+}
+
+/* makes the <len> bytes at offset <addr> of <dht>, which room was previously
+ * taken with dht_reserve(), its new head entry, if the table still permits it
+ * once the entries it had to evict are gone. Only the index is updated, the
+ * caller sets the lengths. Returns zero if the entry must be inserted as usual
+ * instead.
+ */
+static int dht_adopt(struct dht *dht, uint32_t addr, uint32_t len)
+{
+	unsigned int head, wrap;
+	uint32_t low;
+
+	if (!dht->used) {
+		if (addr < sizeof(*dht) + sizeof(dht->dte[0]))
+			return 0;
+		dht->front = dht->head = 0;
+		dht->wrap  = dht->used = 1;
+		dht->total = 0;
+		dht->dte[0].addr = addr;
+		return 1;
+	}
+
+	low = dht->dte[dht->front].addr;
+	if (addr < low)
+		low = addr;
+
+	if (!dht_next_slot(dht, low, &head, &wrap) || !dht_room_at(dht, addr, len, wrap))
+		return 0;
+
+	if (addr < dht->dte[dht->front].addr)
+		dht->front = head;
+	dht->head = head;
+	dht->wrap = wrap;
+	dht->used++;
+	dht->dte[head].addr = addr;
+	return 1;
+}
+
+/* tries to insert a new header <name>:<value> in front of the current head of
+ * table <*dht_ptr>. If the table needs to be defragmented, it is rebuilt into
+ * <*alt>, which must be at least as large, then both pointers are swapped.
+ * Returns zero if the entry is too large for the table, which is then left
+ * empty, otherwise 1 plus the number of defragmentations that were needed.
+ * If <alt> is NULL, -1 is returned instead of defragmenting, and the table is
+ * left untouched provided that no entry had to be evicted. -2 is returned with
+ * the table untouched if the entry would fit but its name or value is longer
+ * than DHT_STR_MAX. If the value immediately follows the name in room of the
+ * table taken with dht_reserve(), the entry is kept there when possible,
+ * otherwise it is moved.
+ */
+int dht_insert(struct dht **dht_ptr, struct str name, struct str value, struct dht **alt)
+{
+	struct dht *dht = *dht_ptr;
+	int ret = 1;
+	unsigned int used;
+	unsigned int head;
+	unsigned int prev;
+	unsigned int wrap;
+	unsigned int tail;
+	uint32_t headroom, tailroom;
+
+	/* the descriptor stores the lengths on 16 bits */
+	if ((name.len > DHT_STR_MAX || value.len > DHT_STR_MAX) &&
+	    name.len + value.len + 32 <= dht->size)
+		return -2;
+
+	if (!dht_make_room(dht, name.len + value.len))
+		return 0;
+
+	if (name.ptr >= (char *)dht && name.ptr + name.len == value.ptr &&
+	    value.ptr + value.len <= (char *)dht + dht->size &&
+	    dht_adopt(dht, name.ptr - (char *)dht, name.len + value.len)) {
+		/* built in place */
+		head = dht->head;
+		dht->total         += name.len + value.len;
+		dht->dte[head].nlen = name.len;
+		dht->dte[head].vlen = value.len;
+		return ret;
+	}
+
+	used = dht->used;
+	prev = head = dht->head;
+	wrap = dht->wrap;
+	tail = dht_get_tail(dht);
+
+	/* Now there is enough room in the table, that's guaranteed by the
+	 * protocol, but not necessarily where we need it.
+	 */
+
+	if (!used) {
+		/* easy, the table was empty */
+		dht->front = dht->head = 0;
+		dht->wrap  = dht->used = 1;
+		dht->total = 0;
+		head = 0;
+		dht->dte[head].addr = dht->size - (name.len + value.len);
+		goto copy;
+	}
+
+	/* compute the new head, used and wrap position */
+	used++;
+	head++;
+
+	if (head >= wrap) {
+		/* head is leading the entries, we either need to push the
+		 * table further or to loop back to released entries. We could
+		 * force to loop back when at least half of the allocatable
+		 * entries are free but in practice it never happens.
+		 */
+		if ((sizeof(*dht) + (wrap + 1) * sizeof(dht->dte[0]) <= dht->dte[dht->front].addr))
+			wrap++;
+		else if (head >= used) /* there's a hole at the beginning */
+			head = 0;
+		else {
+			/* no more room, head hits tail and the index cannot be
+			 * extended, we have to realign the whole table.
+			 */
+			if (!alt)
+				return -1;
+			dht = dht_defrag(dht, alt, dht->size);
+			ret++;
+			wrap = dht->wrap + 1;
+			head = dht->head + 1;
+			prev = head - 1;
+			tail = 0;
+		}
+	}
+	else if (used >= wrap) {
+		/* we've hit the tail, we need to reorganize the index so that
+		 * the head is at the end (but not necessarily move the data).
+		 */
+		if (!alt)
+			return -1;
+		dht = dht_defrag(dht, alt, dht->size);
+		ret++;
+		wrap = dht->wrap + 1;
+		head = dht->head + 1;
+		prev = head - 1;
+		tail = 0;
+	}
+
+	/* Now we have updated head, used and wrap, we know that there is some
+	 * available room at least from the protocol's perspective. This space
+	 * is split in two areas :
+	 *
+	 *   1: if the previous head was the front cell, the space between the
+	 *      end of the index table and the front cell's address.
+	 *   2: if the previous head was the front cell, the space between the
+	 *      end of the tail and the end of the table ; or if the previous
+	 *      head was not the front cell, the space between the end of the
+	 *      tail and the head's address.
+	 */
+	if (prev == dht->front) {
+		/* the area was contiguous */
+		headroom = dht->dte[dht->front].addr - (sizeof(*dht) + wrap * sizeof(dht->dte[0]));
+		tailroom = dht->size - dht->dte[tail].addr - dht->dte[tail].nlen - dht->dte[tail].vlen;
+	}
+	else {
+		/* it's already wrapped so we can't store anything in the headroom */
+		headroom = 0;
+		tailroom = dht->dte[prev].addr - dht->dte[tail].addr - dht->dte[tail].nlen - dht->dte[tail].vlen;
+	}
+
+	/* We can decide to stop filling the headroom as soon as there's enough
+	 * room left in the tail to suit the protocol, but tests show that in
+	 * practice it almost never happens in other situations so the extra
+	 * test is useless and we simply fill the headroom as long as it's
+	 * available.
+	 */
+	if (headroom >= name.len + value.len) {
+		/* install upfront and update ->front */
+		dht->dte[head].addr = dht->dte[dht->front].addr - (name.len + value.len);
+		dht->front = head;
+	}
+	else if (tailroom >= name.len + value.len) {
+		dht->dte[head].addr = dht->dte[tail].addr + dht->dte[tail].nlen + dht->dte[tail].vlen + tailroom - (name.len + value.len);
+	}
+	else {
+		/* need to defragment the table before inserting upfront */
+		if (!alt)
+			return -1;
+		dht = dht_defrag(dht, alt, dht->size);
+		ret++;
+		wrap = dht->wrap + 1;
+		head = dht->head + 1;
+		dht->dte[head].addr = dht->dte[dht->front].addr - (name.len + value.len);
+		dht->front = head;
+	}
+
+	dht->wrap = wrap;
+	dht->head = head;
+	dht->used = used;
+
+ copy:
+	dht->total         += name.len + value.len;
+	dht->dte[head].nlen = name.len;
+	dht->dte[head].vlen = value.len;
+
+	if (name.ptr + name.len == value.ptr) {
+		/* may have been built in room overlapping its final place */
+		memmove((void *)dht + dht->dte[head].addr, name.ptr, name.len + value.len);
+	} else {
+		memcpy((void *)dht + dht->dte[head].addr, name.ptr, name.len);
+		memcpy((void *)dht + dht->dte[head].addr + name.len, value.ptr, value.len);
+	}
+	*dht_ptr = dht;
+	return ret;
+}
+
+/* evicts the <n> oldest entries of <dht>, which must contain at least <n> */
+static void dht_evict(struct dht *dht, unsigned int n)
+{
+	unsigned int tail;
+
+	while (n--) {
+		tail = dht_get_tail(dht);
+		dht->total -= dht->dte[tail].nlen + dht->dte[tail].vlen;
+		if (tail == dht->front)
+			dht->front = dht->head;
+		dht->used--;
+	}
+
+	/* realign if empty */
+	if (!dht->used)
+		dht->front = dht->head = 0;
+
+	/* pack the table if it doesn't wrap anymore */
+	if (dht->head + 1U >= dht->used)
+		dht->wrap = dht->head + 1;
+}
+
+/* Changes the size of table <*dht_ptr> to <size> bytes, which both it and <*alt>
+ * must have been allocated for. The oldest entries are evicted until the
+ * remaining ones fit. A smaller table is compacted into <*alt> at its new size,
+ * then both are swapped. A larger table has its contents moved to the new end
+ * of the area. <*alt> is emptied in any case.
+ */
+void dht_resize(struct dht **dht_ptr, struct dht **alt, uint32_t size)
+{
+	struct dht *dht = *dht_ptr;
+	uint32_t low, delta;
+	unsigned int slot, n;
+
+	while (dht->used && dht->used * 32 + dht->total > size)
+		dht_evict(dht, 1);
+
+	if (!dht->used)
+		init_dht(dht, size);
+	else if (size < dht->size)
+		*dht_ptr = dht = dht_defrag(dht, alt, size);
+	else if (size > dht->size) {
+		/* move everything from the lowest entry by the size difference */
+		low = dht->size;
+		for (slot = dht_get_tail(dht), n = dht->used; n; n--) {
+			if (dht->dte[slot].addr < low)
+				low = dht->dte[slot].addr;
+			if (++slot >= dht->wrap)
+				slot = 0;
+		}
+
+		delta = size - dht->size;
+		memmove((void *)dht + low + delta, (void *)dht + low, dht->size - low);
+		for (slot = dht_get_tail(dht), n = dht->used; n; n--) {
+			dht->dte[slot].addr += delta;
+			if (++slot >= dht->wrap)
+				slot = 0;
+		}
+		dht->size = size;
+	}
+
+	init_dht(*alt, size);
+}
+
+/* returns non-zero if <dht> is getting close to a defragmentation, which is
+ * the case when a wrapped index has only a few free slots left, or when the
+ * room the next entry would be stored in is less than half of the free space.
+ * A table that is not fragmented has almost all of its free space in a single
+ * area, but since the protocol allows the data to use all but 24 bytes per
+ * entry of it, absolute thresholds would keep a full table compacting.
+ */
+static inline int dht_fragmented(const struct dht *dht)
+{
+	uint32_t end, idx, room, free;
+	unsigned int tail;
+
+	if (!dht->used)
+		return 0;
+
+	if (dht->head + 1U < dht->wrap && dht->wrap - dht->used < DHT_INC_SLOTS)
+		return 1;
+
+	tail = dht_get_tail(dht);
+	end = dht->dte[tail].addr + dht->dte[tail].nlen + dht->dte[tail].vlen;
+	if (dht->head == dht->front) {
+		/* the larger of the areas above the index and after the tail */
+		idx = sizeof(*dht) + (dht->wrap + 1) * sizeof(dht->dte[0]);
+		room = dht->dte[dht->front].addr > idx ? dht->dte[dht->front].addr - idx : 0;
+		if (dht->size - end > room)
+			room = dht->size - end;
+	}
+	else
+		room = dht->dte[dht->head].addr - end;
+
+	free = dht->size - sizeof(*dht) - dht->wrap * sizeof(dht->dte[0]) - dht->total;
+	return room < free / 2;
+}
+
+/* Same as dht_insert() but compacts the table incrementally instead of waiting
+ * for a full defragmentation. Once the table gets fragmented, each insertion
+ * also copies up to DHT_INC_STEP of its oldest entries not yet copied into
+ * <*alt>, in insertion order, so that <*alt> is built as a compact copy of the
+ * table. Entries evicted from the table are evicted from the copy as well.
+ * Once the copy has caught up with the head, both tables are swapped. A full
+ * defragmentation may still be needed if the table runs out of room before
+ * that, in which case the copy is simply discarded. Returns the same values as
+ * dht_insert().
+ */
+int dht_insert_inc(struct dht **dht_ptr, struct str name, struct str value, struct dht **alt_ptr)
+{
+	unsigned int used = (*dht_ptr)->used;
+	struct dht *dht, *alt;
+	const struct dte *dte;
+	unsigned int evicted;
+	int step, ret;
+
+	ret = dht_insert(dht_ptr, name, value, alt_ptr);
+	dht = *dht_ptr;
+	alt = *alt_ptr;
+
+	if (ret < 0)
+		return ret;
+
+	if (ret != 1) {
+		/* the table was emptied, or <alt> was used to defragment it */
+		init_dht(alt, dht->size);
+		return ret;
+	}
+
+	if (alt->used) {
+		/* <alt> holds copies of the oldest entries, drop evicted ones */
+		evicted = used + 1 - dht->used;
+		dht_evict(alt, evicted < alt->used ? evicted : alt->used);
+	}
+
+	if (!alt->used && !dht_fragmented(dht))
+		return ret;
+
+	for (step = 0; step < DHT_INC_STEP && alt->used < dht->used; step++) {
+		dte = hpack_get_dte(dht, dht->used - alt->used);
+		if (dht_insert(&alt, hpack_get_name(dht, dte), hpack_get_value(dht, dte), NULL) <= 0) {
+			/* the copy itself got fragmented, start over later */
+			init_dht(alt, alt->size);
+			return ret;
+		}
+	}
+
+	if (alt->used == dht->used) {
+		/* the copy is complete and compact, use it from now on */
+		*dht_ptr = alt;
+		*alt_ptr = dht;
+		init_dht(dht, dht->size);
+	}
+	return ret;
+}
+
+/* allocate a dynamic headers table of <size> bytes and return it initialized */
+struct dht *alloc_dht(uint32_t size)
+{
+	struct dht *dht;
+
+	dht = calloc(1, size);
+	if (!dht)
+		return dht;
+
+	init_dht(dht, size);
+	return dht;
+}
+
+/* the calling thread's pool */
+static __thread struct hpack_pool thread_pool;
+
+/* returns the calling thread's pool. Its areas are only allocated on demand. */
+struct hpack_pool *hpack_pool_get(void)
+{
+	return &thread_pool;
+}
+
+/* grows the areas of <pool> so that it offers a swap area of at least <swap>
+ * bytes and two trash buffers of at least <trash> bytes. Areas which are
+ * already large enough are left untouched. Returns < 0 on allocation failure,
+ * in which case the pool keeps its previous areas.
+ */
+int hpack_pool_reserve(struct hpack_pool *pool, uint32_t swap, uint32_t trash)
+{
+	struct dht *new_swap;
+	char *new_trash;
+
+	if (swap > pool->swap_size) {
+		new_swap = malloc(swap);
+		if (!new_swap)
+			return -1;
+		free(pool->swap);
+		pool->swap = new_swap;
+		pool->swap_size = swap;
+	}
+
+	if (trash > pool->trash_size) {
+		/* both buffers come from a single allocation */
+		new_trash = malloc(2 * trash);
+		if (!new_trash)
+			return -1;
+		free(pool->trash[0]);
+		pool->trash[0] = new_trash;
+		pool->trash[1] = new_trash + trash;
+		pool->trash_size = trash;
+	}
+	return 0;
+}
+
+/* releases the areas of <pool>, which remains usable */
+void hpack_pool_release(struct hpack_pool *pool)
+{
+	free(pool->swap);
+	free(pool->trash[0]);
+	memset(pool, 0, sizeof(*pool));
+}
@@ -0,0 +1,200 @@
+/* HPACK dynamic headers table, shared by the encoder and the decoder */
+
+#ifndef _HPACK_TBL_H
+#define _HPACK_TBL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct str {
+	char  *ptr;
+	size_t len;
+};
+
+/* a header field */
+struct hpack_hdr {
+	struct str n; /* name */
+	struct str v; /* value */
+};
+
+/* number of entries in the static table */
+#define HPACK_SH_SIZE 61
+
+extern const struct hpack_hdr hpack_sh[HPACK_SH_SIZE + 1];
+
+/* Dynamic Headers Table, usable for tables up to 4GB long and values of 64kB-1.
+ * The model can be improved by using offsets relative to the table entry's end
+ * or to the end of the area, or by moving the descriptors at the end of the
+ * table and the data at the beginning. This entry is 8 bytes long, which is 1/4
+ * of the bookkeeping planned by the HPACK spec. Thus it saves 24 bytes per
+ * header field, meaning that even with a single header, 24 extra bytes can be
+ * stored (ie one such descriptor). At 29.2 average bytes per header field as
+ * found in the hpack test case, that's slightly more than 1.5kB of space saved
+ * from a 4kB block, resulting in contiguous space almost always being
+ * available.
+ *
+ * Principle: the table is stored in a contiguous array containing both the
+ * descriptors and the contents. Descriptors are stored at the beginning of the
+ * array while contents are stored starting from the end. Most of the time there
+ * is enough room left in the table to insert a new header field, thanks to the
+ * savings on the descriptor size. Thus by inserting headers from the end it's
+ * possible to maximize the delay before a collision of DTEs and data. In order
+ * to always insert from the right, we need to keep a reference to the latest
+ * inserted element and look before it. The last inserted cell's address defines
+ * the lowest konwn address still in use, unless the area wraps in which case
+ * the available space lies between the end of the tail and the beginning of the
+ * head.
+ *
+ * In order to detect collisions between data blocks and DTEs, we also maintain
+ * an index to the lowest element facing the DTE table, called "front". This one
+ * is updated each time an element is inserted before it. Once the buffer wraps,
+ * this element doesn't have to be updated anymore until it is released, in
+ * which case the buffer doesn't wrap anymore and the front element becomes the
+ * head again.
+ *
+ * Various heuristics are possible concerning the opportunity to wrap the
+ * entries to limit the risk of collisions with the DTE, but experimentation
+ * shows that thanks to the important savings made on the descriptors, the
+ * likeliness of finding a large amount of free space at the end of the area is
+ * much higher than the risk of colliding, so in the end the most naive
+ * algorithms work pretty fine. Typical ratios of 1 collision per 2000 requests
+ * have been observed.
+ *
+ * The defragmentation should be rare ; a study on live data shows on average
+ * 29.2 bytes used per header field. This plus the 32 bytes overhead fix an
+ * average of 66.9 header fields per 4kB table. This brings a 1606 bytes saving
+ * using the current storage description, ensuring that oldest headers are
+ * linearly removed by the sender before fragmentation occurs. This means that
+ * for all smaller header fields there will not be any requirement to defragment
+ * the area and most of the time it will even be possible to copy the old values
+ * directly within the buffer after creating a new entry. On average within the
+ * available space there will be enough room to store 1606/(29.2+8)=43 extra
+ * header fields without switching to another place.
+ *
+ * The table header fits in the table itself, it only takes 16 bytes, so in the
+ * worst case (1 single header) it's possible to store 4096 - 16 - 8 = 4072
+ * data bytes, which is larger than the 4064 the protocol requires (4096 - 32).
+ */
+
+
+/* longest name or value an entry may store, see struct dte */
+#define DHT_STR_MAX 65535
+
+/* One dynamic table entry descriptor */
+struct dte {
+	uint32_t addr;  /* storage address, relative to the dte address */
+	uint16_t nlen;  /* header name length */
+	uint16_t vlen;  /* header value length */
+};
+
+/* Note: the table's head plus a struct dte must be smaller than or equal to 32
+ * bytes so that a single large header can always fit. Here that's 16 bytes for
+ * the header, plus 8 bytes per slot.
+ * Note that when <used> == 0, front, head, and wrap are undefined.
+ */
+struct dht {
+	uint32_t size;  /* allocated table size in bytes */
+	uint32_t total; /* sum of nlen + vlen in bytes */
+	uint16_t front; /* slot number of the first node after the idx table */
+	uint16_t wrap;  /* number of allocated slots, wraps here */
+	uint16_t head;  /* last inserted slot number */
+	uint16_t used;  /* number of slots in use */
+	struct dte dte[0]; /* dynamic table entries */
+};
+
+/* Per-thread scratch space. All the contexts run by a thread share its pool
+ * since they never use it concurrently, and no two threads ever share one, so
+ * that workers decoding independent connections need neither locks nor shared
+ * cache lines. <swap> is where the encoder's tables are defragmented, and
+ * <trash> are the buffers holding a name and a value while a header block is
+ * decoded.
+ */
+struct hpack_pool {
+	struct dht *swap;       /* defragmentation area */
+	uint32_t swap_size;     /* size of <swap> in bytes */
+	uint32_t trash_size;    /* size of each of <trash> in bytes */
+	char *trash[2];         /* name and value buffers */
+};
+
+/* makes an str struct from a string and a length */
+static inline struct str mkstr(const char *ptr, size_t len)
+{
+	struct str ret = { .ptr = (char *)ptr, .len = len };
+	return ret;
+}
+
+/* returns the slot number of the oldest entry (tail). Must not be used on an
+ * empty table.
+ */
+static inline unsigned int dht_get_tail(const struct dht *dht)
+{
+	return ((dht->head + 1U < dht->used) ? dht->wrap : 0) + dht->head + 1U - dht->used;
+}
+
+/* return a pointer to the entry designated by index <idx> (starting at 1) or
+ * NULL if this index is not there.
+ */
+static inline const struct dte *hpack_get_dte(const struct dht *dht, uint32_t idx)
+{
+	idx--;
+
+	if (idx >= dht->used)
+		return NULL;
+
+	if (idx <= dht->head)
+		idx = dht->head - idx;
+	else
+		idx = dht->head - idx + dht->wrap;
+
+	return &dht->dte[idx];
+}
+
+/* return a pointer to the header name for entry <dte>. */
+static inline struct str hpack_get_name(const struct dht *dht, const struct dte *dte)
+{
+	struct str ret = {
+		.ptr = (void *)dht + dte->addr,
+		.len = dte->nlen,
+	};
+	return ret;
+}
+
+/* return a pointer to the header value for entry <dte>. */
+static inline struct str hpack_get_value(const struct dht *dht, const struct dte *dte)
+{
+	struct str ret = {
+		.ptr = (void *)dht + dte->addr + dte->nlen,
+		.len = dte->vlen,
+	};
+	return ret;
+}
+
+/* initializes dynamic headers table <dht> of <size> bytes */
+static inline void init_dht(struct dht *dht, uint32_t size)
+{
+	dht->size = size;
+	dht->total = 0;
+	dht->used = 0;
+}
+
+void dht_check_consistency(const struct dht *dht);
+char *dht_reserve(const struct dht *dht, uint32_t len);
+int dht_insert(struct dht **dht_ptr, struct str name, struct str value, struct dht **alt);
+int dht_insert_inc(struct dht **dht_ptr, struct str name, struct str value, struct dht **alt);
+void dht_resize(struct dht **dht_ptr, struct dht **alt, uint32_t size);
+struct dht *alloc_dht(uint32_t size);
+struct hpack_pool *hpack_pool_get(void);
+int hpack_pool_reserve(struct hpack_pool *pool, uint32_t swap, uint32_t trash);
+void hpack_pool_release(struct hpack_pool *pool);
+
+/* returns a swap area of at least <size> bytes from <pool>, or NULL if it
+ * cannot be allocated.
+ */
+static inline struct dht *hpack_pool_swap(struct hpack_pool *pool, uint32_t size)
+{
+	if (pool->swap_size < size && hpack_pool_reserve(pool, size, 0) < 0)
+		return NULL;
+	return pool->swap;
+}
+
+#endif
@@ -0,0 +1,13 @@
+/* libhpack public API : the encoder and decoder contexts, the Huffman coders
+ * and the integer primitives. Programs only need to include this file and to
+ * link with libhpack.a.
+ */
+
+#ifndef _HPACK_H
+#define _HPACK_H
+
+#include "hpack-enc.h"
+#include "hpack-dec.h"
+#include "hpack-huff.h"
+
+#endif
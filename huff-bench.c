@@ -0,0 +1,542 @@
+/* Huffman encoder/decoder benchmark for experimentation purposes.
+ *
+ * It reads the same input format as mini-enc (ie: fake-hdrs.py's output) and
+ * runs all header names and values in loops through the various Huffman
+ * functions. Throughput is always reported in MB/s of input strings (ie the
+ * non-encoded form), so that encoders and decoders can be compared. Decoders
+ * are reported per string length bucket. Since the fake-hdrs.py output does
+ * not contain any long string, "-c" adds the requested number of random
+ * cookie-like strings of 100 to 400 bytes.
+ *
+ *     ./huff-bench [-l loops] [-c cookies] < test.hdrs
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hpack.h"
+
+/* Strings are processed in chunks of this many, each chunk being run <loops>
+ * times before switching to the next one. This roughly matches a couple of
+ * requests, and ensures that we measure the CPU cost of the Huffman functions
+ * on hot data as it would be for a header block just received, and not the
+ * cost of bringing the whole input from memory.
+ */
+#define CHUNK 64
+
+/* longest generated cookie */
+#define MAX_COOKIE 400
+
+struct bstr {
+	char *ptr;      /* raw string, zero-terminated */
+	int len;        /* raw string length */
+	uint8_t *huff;  /* huffman-encoded string */
+	int hlen;       /* huffman-encoded length */
+};
+
+static struct bstr *strs;
+static int nb_strs;
+static long total_bytes;
+
+/* string length buckets for the decoders, filled after loading */
+static struct bucket {
+	const char *name;
+	int min, max;   /* string lengths, inclusive */
+	int *idx;       /* indexes in strs[] */
+	int nb;         /* number of strings */
+	long bytes;     /* total bytes */
+} buckets[] = {
+	{ .name = "<16",   .min = 0,   .max = 15      },
+	{ .name = "16-99", .min = 16,  .max = 99      },
+	{ .name = ">=100", .min = 100, .max = INT_MAX },
+};
+
+#define NB_BUCKETS (int)(sizeof(buckets) / sizeof(buckets[0]))
+
+static char in[256];
+static char out[MAX_COOKIE * 4]; /* at most 32-bit per input char */
+static uint8_t lit[MAX_COOKIE + 5]; /* string literal with its length prefix */
+
+/* returns the current time in nanoseconds */
+static inline uint64_t now_ns()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* appends string <s> of length <len> to the strs array. Returns < 0 on error. */
+static int add_str(const char *s, int len)
+{
+	struct bstr *new;
+
+	if ((nb_strs & (nb_strs - 1)) == 0) {
+		new = realloc(strs, (nb_strs ? nb_strs * 2 : 1) * sizeof(*strs));
+		if (!new)
+			return -1;
+		strs = new;
+	}
+
+	strs[nb_strs].ptr  = strndup(s, len);
+	strs[nb_strs].len  = len;
+	strs[nb_strs].huff = malloc(len * 4 + 1);
+	if (!strs[nb_strs].ptr || !strs[nb_strs].huff)
+		return -1;
+
+	strs[nb_strs].hlen = huff_enc(strs[nb_strs].ptr, (char *)strs[nb_strs].huff);
+	total_bytes += len;
+	nb_strs++;
+	return 0;
+}
+
+/* loads all names and values from stdin. Returns < 0 on error. */
+static int load_input()
+{
+	char *v, *p;
+
+	while (fgets(in, sizeof(in), stdin)) {
+		if (*in == '\n' || !*in)
+			continue;
+
+		v = in + 1;
+		while (*v != ':' && *v && *v != '\n')
+			v++;
+
+		if (*v != ':')
+			return -1;
+
+		if (add_str(in, v - in) < 0)
+			return -1;
+
+		v++;
+		while (*v == ' ')
+			v++;
+
+		p = v;
+		while (*p != '\n' && *p)
+			p++;
+
+		if (add_str(v, p - v) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+/* adds <count> random base64-like strings of 100 to MAX_COOKIE bytes, looking
+ * like session cookies. The generator is seeded so that runs are comparable.
+ * Returns < 0 on error.
+ */
+static int add_cookies(int count)
+{
+	static const char b64[] =
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+	char cookie[MAX_COOKIE];
+	int len, i;
+
+	srandom(0);
+	while (count--) {
+		len = 100 + random() % (MAX_COOKIE - 100 + 1);
+		memcpy(cookie, "session=", 8);
+		for (i = 8; i < len; i++)
+			cookie[i] = b64[random() % 64];
+		if (add_str(cookie, len) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+/* assigns all strings to their length bucket. Returns < 0 on error. */
+static int fill_buckets()
+{
+	struct bucket *b;
+	int i;
+
+	for (b = buckets; b < buckets + NB_BUCKETS; b++) {
+		b->idx = malloc(nb_strs * sizeof(*b->idx));
+		if (!b->idx)
+			return -1;
+
+		for (i = 0; i < nb_strs; i++) {
+			if (strs[i].len < b->min || strs[i].len > b->max)
+				continue;
+			b->idx[b->nb++] = i;
+			b->bytes += strs[i].len;
+		}
+	}
+	return 0;
+}
+
+/* emits string <str> as a string literal using hpack_enc_str(), and checks
+ * that it decodes back to the original string, and that it was huffman-encoded
+ * only if it is shorter. Returns < 0 on error.
+ */
+static int check_lit(const struct bstr *str)
+{
+	const uint8_t *p = lit;
+	uint32_t len;
+	int shift = 0;
+	int ret;
+
+	ret = hpack_enc_str(str->ptr, str->len, lit);
+
+	len = *p++ & 127;
+	if (len == 127) {
+		do {
+			len += (*p & 127) << shift;
+			shift += 7;
+		} while (*p++ & 128);
+	}
+
+	if (p + len != lit + ret)
+		return -1;
+
+	if (!(*lit & 0x80))
+		return (len == (uint32_t)str->len && memcmp(p, str->ptr, len) == 0) ? 0 : -1;
+
+	if ((int)len != str->hlen || str->hlen >= str->len)
+		return -1;
+	ret = huff_dec(p, len, out, sizeof(out));
+	return (ret == str->len && memcmp(out, str->ptr, ret) == 0) ? 0 : -1;
+}
+
+/* decodes strings made only of the shortest codes (5 bits) with each engine,
+ * into an output of 8/5 of their encoded length, which is the largest length
+ * any string may decode to, and which they exactly fill once the padding is
+ * ignored. Returns the number of mismatches.
+ */
+static int check_shortest()
+{
+	const struct huff_dec_engine *engine;
+	static char str[MAX_COOKIE + 1];
+	uint8_t huff[MAX_COOKIE];
+	int errors = 0;
+	int hlen, len, olen;
+
+	for (len = 1; len <= MAX_COOKIE; len++) {
+		memset(str, 'e', len);
+		str[len] = 0;
+		hlen = huff_enc(str, (char *)huff);
+		olen = hlen * 8 / 5;
+		if (olen != len)
+			continue;
+		for (engine = huff_dec_engines; engine->name; engine++) {
+			if (engine->dec(huff, hlen, out, olen) != len || memcmp(out, str, len) != 0) {
+				fprintf(stderr, "%s: mismatch on %d 'e' in %d bytes\n", engine->name, len, olen);
+				errors++;
+			}
+		}
+	}
+	return errors;
+}
+
+/* decodes all encoded strings with each engine and compares them to the
+ * original ones. Returns the number of mismatches.
+ */
+static int check_strs()
+{
+	const struct huff_dec_engine *engine;
+	int errors = 0;
+	int i, len;
+
+	for (i = 0; i < nb_strs; i++) {
+		if (check_lit(&strs[i]) < 0) {
+			fprintf(stderr, "hpack_enc_str: mismatch on <%s>\n", strs[i].ptr);
+			errors++;
+		}
+	}
+
+	for (i = 0; i < nb_strs; i++) {
+		if (huff_dec_len(strs[i].huff, strs[i].hlen) != strs[i].len) {
+			fprintf(stderr, "huff_dec_len: mismatch on <%s>\n", strs[i].ptr);
+			errors++;
+		}
+	}
+
+	for (engine = huff_dec_engines; engine->name; engine++) {
+		for (i = 0; i < nb_strs; i++) {
+			len = engine->dec(strs[i].huff, strs[i].hlen, out, sizeof(out));
+			if (len != strs[i].len || memcmp(out, strs[i].ptr, len) != 0) {
+				fprintf(stderr, "%s: mismatch on <%s>\n", engine->name, strs[i].ptr);
+				errors++;
+			}
+
+			/* the output may be just large enough, but not shorter */
+			len = engine->dec(strs[i].huff, strs[i].hlen, out, strs[i].len);
+			if (len != strs[i].len || memcmp(out, strs[i].ptr, len) != 0 ||
+			    (strs[i].len && engine->dec(strs[i].huff, strs[i].hlen, out, strs[i].len - 1) >= 0)) {
+				fprintf(stderr, "%s: mismatch on <%s> with an exact output\n", engine->name, strs[i].ptr);
+				errors++;
+			}
+		}
+	}
+	return errors + check_shortest();
+}
+
+/* returns the throughput in MB/s for <bytes> input bytes processed in <ns> ns */
+static inline double mbps(uint64_t bytes, uint64_t ns)
+{
+	return ns ? bytes * 1000.0 / ns : 0.0;
+}
+
+/* reports the throughput for <bytes> input bytes processed in <ns> ns */
+static void report(const char *name, uint64_t bytes, uint64_t ns)
+{
+	printf("%-24s: %8.2f MB/s\n", name, mbps(bytes, ns));
+}
+
+static void bench_enc_len(int loops)
+{
+	uint64_t start;
+	int b, i, l, ret = 0;
+
+	start = now_ns();
+	for (b = 0; b < nb_strs; b += CHUNK)
+		for (l = 0; l < loops; l++)
+			for (i = b; i < b + CHUNK && i < nb_strs; i++)
+				ret += huff_enc_len(strs[i].ptr, strs[i].len);
+	report("huff_enc_len (count)", (uint64_t)total_bytes * loops, now_ns() - start);
+	if (ret < 0) // only used to keep the loop
+		printf("%d\n", ret);
+}
+
+static void bench_enc(int loops)
+{
+	uint64_t start;
+	int b, i, l, ret = 0;
+
+	start = now_ns();
+	for (b = 0; b < nb_strs; b += CHUNK)
+		for (l = 0; l < loops; l++)
+			for (i = b; i < b + CHUNK && i < nb_strs; i++)
+				ret += huff_enc(strs[i].ptr, out);
+	report("huff_enc (emit)", (uint64_t)total_bytes * loops, now_ns() - start);
+	if (ret < 0) // only used to keep the loop
+		printf("%d\n", ret);
+}
+
+/* emits all strings as string literals the way it was done before bounded
+ * encoding was available: the huffman length is estimated first, then the
+ * string is either huffman-encoded or copied.
+ */
+static void bench_lit_2pass(int loops)
+{
+	uint64_t start;
+	int b, i, l, len, ret = 0;
+
+	start = now_ns();
+	for (b = 0; b < nb_strs; b += CHUNK) {
+		for (l = 0; l < loops; l++) {
+			for (i = b; i < b + CHUNK && i < nb_strs; i++) {
+				len = huff_enc_len(strs[i].ptr, strs[i].len);
+				if (len < strs[i].len) {
+					ret += put_var_int(lit, 0x80, len, 7);
+					ret += huff_enc(strs[i].ptr, (char *)lit + 5);
+				} else {
+					ret += put_var_int(lit, 0x00, strs[i].len, 7);
+					memcpy(lit + 5, strs[i].ptr, strs[i].len);
+					ret += strs[i].len;
+				}
+			}
+		}
+	}
+	report("literal (2-pass)", (uint64_t)total_bytes * loops, now_ns() - start);
+	if (ret < 0) // only used to keep the loop
+		printf("%d\n", ret);
+}
+
+static void bench_lit_bounded(int loops)
+{
+	uint64_t start;
+	int b, i, l, ret = 0;
+
+	start = now_ns();
+	for (b = 0; b < nb_strs; b += CHUNK)
+		for (l = 0; l < loops; l++)
+			for (i = b; i < b + CHUNK && i < nb_strs; i++)
+				ret += hpack_enc_str(strs[i].ptr, strs[i].len, lit);
+	report("literal (bounded)", (uint64_t)total_bytes * loops, now_ns() - start);
+	if (ret < 0) // only used to keep the loop
+		printf("%d\n", ret);
+}
+
+/* runs each supported length estimator, then huff_len_bits(), on random
+ * printable strings of 8 to 4096 bytes, after checking that they all return the
+ * same as the scalar one, also when some bytes are not ASCII. Each size is run
+ * on <loops> MB of input. Returns < 0 on mismatch.
+ */
+static int bench_len(int loops)
+{
+	const struct huff_len_engine *engine;
+	static uint8_t buf[4096 + 8];
+	static uint8_t mix[4096 + 8];
+	uint64_t start, iters, i;
+	uint32_t ret = 0;
+	int size, ofs;
+
+	/* the checks also run on a copy where one byte in 64 is not ASCII,
+	 * so that vectors are counted both ways.
+	 */
+	srandom(0);
+	for (i = 0; i < sizeof(buf); i++) {
+		buf[i] = 0x20 + random() % 95;
+		mix[i] = (random() % 64) ? buf[i] : 0x80 + random() % 128;
+	}
+
+	for (engine = huff_len_engines; engine->name; engine++) {
+		if (engine->supported && !engine->supported())
+			continue;
+		for (size = 0; size <= 4096; size++) {
+			for (ofs = 0; ofs < 8; ofs++) {
+				if (engine->len(buf + ofs, size) != huff_len_engines[0].len(buf + ofs, size) ||
+				    engine->len(mix + ofs, size) != huff_len_engines[0].len(mix + ofs, size) ||
+				    huff_len_bits(mix + ofs, size) != huff_len_engines[0].len(mix + ofs, size)) {
+					fprintf(stderr, "%s: mismatch for size %d\n", engine->name, size);
+					return -1;
+				}
+			}
+		}
+	}
+
+	printf("\nLength estimators (MB/s)");
+	for (size = 8; size <= 4096; size *= 2)
+		printf(" %7d", size);
+	printf("\n");
+
+	/* the last run is the one huff_len_bits() picks for each size */
+	for (engine = huff_len_engines; ; engine++) {
+		if (engine->name && engine->supported && !engine->supported())
+			continue;
+		printf("  %-22s", engine->name ? engine->name : "=> picked");
+		for (size = 8; size <= 4096; size *= 2) {
+			iters = (1ULL << 20) * loops / size;
+			start = now_ns();
+			for (i = 0; i < iters; i++)
+				ret += engine->name ? engine->len(buf + (i & 7), size) : huff_len_bits(buf + (i & 7), size);
+			printf(" %7.0f", mbps(iters * size, now_ns() - start));
+		}
+		printf("\n");
+		if (!engine->name)
+			break;
+	}
+	if (ret == 0) // only used to keep the loop
+		printf("%u\n", ret);
+	return 0;
+}
+
+/* runs decoder <engine> <loops> times over the strings of bucket <bk> and
+ * returns the throughput in MB/s.
+ */
+static double bench_dec(const struct huff_dec_engine *engine, const struct bucket *bk, int loops)
+{
+	uint64_t start;
+	int b, i, l, ret = 0;
+
+	start = now_ns();
+	for (b = 0; b < bk->nb; b += CHUNK)
+		for (l = 0; l < loops; l++)
+			for (i = b; i < b + CHUNK && i < bk->nb; i++)
+				ret += engine->dec(strs[bk->idx[i]].huff, strs[bk->idx[i]].hlen, out, sizeof(out));
+	if (ret < 0) // only used to keep the loop
+		printf("%d\n", ret);
+	return mbps((uint64_t)bk->bytes * loops, now_ns() - start);
+}
+
+/* same as bench_dec() for huff_dec_len(), which only validates the strings */
+static double bench_dec_len(const struct bucket *bk, int loops)
+{
+	uint64_t start;
+	int b, i, l, ret = 0;
+
+	start = now_ns();
+	for (b = 0; b < bk->nb; b += CHUNK)
+		for (l = 0; l < loops; l++)
+			for (i = b; i < b + CHUNK && i < bk->nb; i++)
+				ret += huff_dec_len(strs[bk->idx[i]].huff, strs[bk->idx[i]].hlen);
+	if (ret < 0) // only used to keep the loop
+		printf("%d\n", ret);
+	return mbps((uint64_t)bk->bytes * loops, now_ns() - start);
+}
+
+int main(int argc, char **argv)
+{
+	const struct huff_dec_engine *engine;
+	const struct huff_dec_engine *winner[NB_BUCKETS] = { NULL };
+	double best[NB_BUCKETS] = { 0.0 };
+	double res;
+	int loops = 10;
+	int cookies = 0;
+	int err, b;
+
+	while (argc > 1) {
+		if (strcmp(argv[1], "-l") == 0 && argc > 2) {
+			loops = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		else if (strcmp(argv[1], "-c") == 0 && argc > 2) {
+			cookies = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		argv++;
+		argc--;
+	}
+
+	if (load_input() < 0 || add_cookies(cookies) < 0 || fill_buckets() < 0) {
+		fprintf(stderr, "failed to load input\n");
+		exit(1);
+	}
+
+	printf("Total input strings : %d\n", nb_strs);
+	printf("Total input string bytes : %ld\n", total_bytes);
+
+	err = check_strs();
+	if (err) {
+		printf("Encoding errors : %d\n", err);
+		exit(1);
+	}
+
+	bench_enc_len(loops);
+	bench_enc(loops);
+	bench_lit_2pass(loops);
+	bench_lit_bounded(loops);
+
+	if (bench_len(loops) < 0)
+		exit(1);
+
+	printf("\nDecoders (MB/s)  ");
+	for (b = 0; b < NB_BUCKETS; b++)
+		printf(" %10s", buckets[b].name);
+	printf("\n%-17s", "  strings");
+	for (b = 0; b < NB_BUCKETS; b++)
+		printf(" %10d", buckets[b].nb);
+	printf("\n");
+
+	for (engine = huff_dec_engines; engine->name; engine++) {
+		printf("  %-15s", engine->name);
+		for (b = 0; b < NB_BUCKETS; b++) {
+			res = buckets[b].nb ? bench_dec(engine, &buckets[b], loops) : 0.0;
+			if (res > best[b]) {
+				best[b] = res;
+				winner[b] = engine;
+			}
+			printf(" %10.2f", res);
+		}
+		printf("\n");
+	}
+
+	printf("  %-15s", "=> winner");
+	for (b = 0; b < NB_BUCKETS; b++)
+		printf(" %10s", winner[b] ? winner[b]->name : "-");
+	printf("\n");
+
+	printf("  %-15s", "length only");
+	for (b = 0; b < NB_BUCKETS; b++)
+		printf(" %10.2f", buckets[b].nb ? bench_dec_len(&buckets[b], loops) : 0.0);
+	printf("\n");
+	return 0;
+}